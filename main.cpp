@@ -6,10 +6,15 @@
  * - inicjalizacja i alokacja pamięci,
  * - algorytmy wypełniania (diagonalna, szachownica),
  * - operacje arytmetyczne (dodawanie, mnożenie),
- * - operatory porównania i modyfikujące.
+ * - operatory porównania i modyfikujące,
+ * - widoki na fragmenty macierzy.
  */
 
 #include "matrix.h"
+#include "matrix_async.h"
+#include "matrix_tuning.h"
+#include "matrix_live.h"
+#include "matrix_lu.h"
 #include <iostream>
 
 using namespace std;
@@ -26,6 +31,15 @@ using namespace std;
  * - Test 5: Użycie operatora() do dodania liczby zmiennoprzecinkowej
  * - Test 6: Realokacja i transponowanie dużej macierzy
  * - Test 7: Operatory porównania
+ * - Test 8: Widoki na blok, wiersz i diagonalę bez kopiowania
+ * - Test 9: Arytmetyka modulo p (mnożenie i potęgowanie)
+ * - Test 10: Asynchroniczny potok operacji (losowanie, mnożenie, zapis)
+ * - Test 11: Strojenie mnożenia, zapis i odczyt pliku strojenia, zgodność algorytmów
+ * - Test 12: Iloczyn aktualizowany przyrostowo
+ * - Test 13: Śledzenie zakresu wartości i mnożenie w arytmetyce 8/16-bitowej
+ * - Test 14: Redukcje (suma, ślad, ekstrema, normy) i skrót zawartości
+ * - Test 15: Wyznacznik (Bareiss, wielomodularnie) i rząd oraz rozkład LU
+ * - Test 16: Duża macierz na dużych stronach z równoległym wypełnianiem
  * 
  * @return int Kod powrotu (0 w przypadku pomyślnego wykonania).
  */
@@ -80,5 +94,147 @@ int main() {
     if (tempH == tempI) std::cout << "Macierze sa rowne.\n";
     else std::cout << "Macierze sa rozne.\n";
 
+    std::cout << "--- Test 8: Widoki (n=6) ---" << std::endl;
+    matrix J(6);
+    J.przekatna();
+    wypelnij(J.blok(0, 3, 3, 3), 7);      // prawy gorny blok 3x3
+    dodaj(J.wiersz_widok(5), 2);          // ostatni wiersz += 2
+    wypelnij(J.przekatna_widok(-1), 4);   // diagonala pod glowna
+    std::cout << J << std::endl;
+    const matrix& JC = J;                 // widoki tylko do odczytu nie wylaczaja sledzenia zakresu
+    const_matrix_view diag = JC.przekatna_widok();
+    std::cout << "Diagonala:";
+    for (int i = 0; i < diag.liczba_kolumn(); ++i) std::cout << " " << diag(0, i);
+    std::cout << ", kolumna 3: " << JC.kolumna_widok(3)(0, 0) << std::endl;
+
+    matrix K(3);
+    mnoz(K.widok(), J.blok(0, 0, 3, 6), J.blok(0, 0, 6, 3)); // iloczyn kafelkow bez kopiowania
+    std::cout << "Iloczyn blokow 3x6 * 6x3:\n" << K << std::endl;
+
+    std::cout << "--- Test 9: Arytmetyka modulo p ---" << std::endl;
+    int tFib[] = {1, 1, 1, 0};
+    matrix Fib(2, tFib);
+    matrix FibN = Fib.potega_mod(1000000000000ULL, 1000000007); // F(10^12) mod (10^9 + 7)
+    std::cout << "[[1,1],[1,0]]^(10^12) mod (10^9+7):\n" << FibN << std::endl;
+
+    std::cout << "--- Test 10: Potok asynchroniczny ---" << std::endl;
+    auto L1 = async_losuj(64);
+    auto L2 = async_losuj(64);
+    auto L3 = async_utworz(64, [](matrix& m) { m.szachownica(); });
+    auto P = async_mnoz(L1, L2);                       // czeka tylko na L1 i L2
+    auto S = async_dodaj(P, async_dowroc(L3));         // L3 transponowane rownolegle z mnozeniem
+    auto zapis = async_zapisz(S, "potok_wynik.txt");
+    std::cout << "Zapis wyniku potoku: " << (zapis.get() ? "ok" : "blad") << std::endl;
+
+    std::cout << "--- Test 11: Strojenie mnozenia (n=200) ---" << std::endl;
+    matrix M1(200); M1.losuj();
+    matrix M2(200); M2.losuj();
+    matrix Wzor(200);
+    const matrix& M1C = M1;                            // odczyt bez wylaczania sledzenia zakresu
+    const matrix& M2C = M2;
+    mnoz(Wzor.widok(), M1C.widok(), M2C.widok());      // jadro naiwne jako wzorzec
+    strojenie::dostroj(256);                           // pomiary i zapis do domyslna_sciezka()
+    strojenie::ustaw(200, {algorytm_mnozenia::naiwny, 64, 1, 256}); // nadpisane w pamieci...
+    bool wczytano = strojenie::wczytaj();              // ...i odtworzone z pliku
+    std::cout << "Wczytano strojenie z " << strojenie::domyslna_sciezka() << ": "
+              << (wczytano ? "tak" : "nie") << std::endl;
+    for (int rozmiar = 64; rozmiar <= 256; rozmiar *= 2) {
+        parametry_mnozenia pm = strojenie::parametry(rozmiar);
+        std::cout << "n=" << rozmiar << ": algorytm " << static_cast<int>(pm.algorytm)
+                  << ", blok " << pm.blok << ", watki " << pm.watki
+                  << ", prog Strassena " << pm.prog_strassena << std::endl;
+    }
+    matrix Wynik = M1 * M2;
+    std::cout << "Zgodnosc z jadrem naiwnym: " << (Wynik == Wzor ? "tak" : "nie") << std::endl;
+
+    std::cout << "--- Test 12: Iloczyn na zywo (n=50) ---" << std::endl;
+    matrix LA(50); LA.losuj();
+    matrix LB(50); LB.losuj();
+    iloczyn_na_zywo LC(LA, LB);
+    LC.wynik();                                        // pierwsze pelne mnozenie
+    int nowy_wiersz[50];
+    for (int i = 0; i < 50; ++i) nowy_wiersz[i] = i % 10;
+    LA.wstaw(3, 7, 9);                                 // poprawka O(n)
+    LB.wiersz(10, nowy_wiersz);                        // poprawka O(n^2)
+    LA.kolumna(20, nowy_wiersz);
+    std::cout << "Oczekujace poprawki: " << LC.liczba_oczekujacych() << std::endl;
+    std::cout << "Zgodnosc z pelnym mnozeniem: " << (LC.wynik() == LA * LB ? "tak" : "nie") << std::endl;
+    std::cout << "Zakres po poprawkach: [" << LC.wynik().zakres_od() << ", " << LC.wynik().zakres_do()
+              << "]" << std::endl;                     // sledzenie zakresu zachowane
+    matrix RA(8), RB(3);                               // rozne rozmiary - iloczyn zerowy
+    iloczyn_na_zywo RC(RA, RB);
+    RC.wynik();
+    RA.wstaw(7, 7, 5);                                 // bez poprawki, pelne przeliczenie
+    RB.wstaw(2, 2, 5);
+    std::cout << "Rozne rozmiary - oczekujace: " << RC.liczba_oczekujacych()
+              << ", wynik zerowy: " << (RC.wynik() == matrix(8) ? "tak" : "nie") << std::endl;
+
+    std::cout << "--- Test 13: Zakres wartosci i waskie mnozenie (n=128) ---" << std::endl;
+    matrix Z1(128); Z1.losuj();                        // zakres [0, 9]
+    matrix Z2(128); Z2.szachownica();                  // zakres [0, 1]
+    Z2 *= -3;                                          // zakres [-3, 0]
+    std::cout << "Zakres Z1: [" << Z1.zakres_od() << ", " << Z1.zakres_do() << "], Z2: ["
+              << Z2.zakres_od() << ", " << Z2.zakres_do() << "]" << std::endl;
+    matrix Z3 = Z1 * Z2;                               // jadro 8-bitowe, gdy dostepne
+    matrix ZWzor(128);
+    const matrix& Z1C = Z1;
+    const matrix& Z2C = Z2;
+    mnoz(ZWzor.widok(), Z1C.widok(), Z2C.widok());
+    std::cout << "Zakres iloczynu: [" << Z3.zakres_od() << ", " << Z3.zakres_do() << "]" << std::endl;
+    std::cout << "Zgodnosc z jadrem naiwnym: " << (Z3 == ZWzor ? "tak" : "nie") << std::endl;
+    Z1.wiersz_widok(0)(0, 5) = 42;                     // zapis przez widok - zakres nieznany
+    std::cout << "Po zapisie przez widok: [" << Z1.zakres_od() << ", " << Z1.zakres_do() << "]";
+    Z1.powiadom_o_zmianie();                           // zakres wyznaczony od nowa
+    std::cout << ", po powiadomieniu: [" << Z1.zakres_od() << ", " << Z1.zakres_do() << "]" << std::endl;
+    {
+        matrix_view stary = Z1.kolumna_widok(3);       // widok zapisywalny wciaz istnieje...
+        Z1.powiadom_o_zmianie();
+        stary(7, 0) = 100;                             // ...i moze zapisac poza wyznaczony zakres
+        std::cout << "Z zywym widokiem: [" << Z1.zakres_od() << ", " << Z1.zakres_do() << "]";
+    }
+    Z1.powiadom_o_zmianie();
+    std::cout << ", po jego zniszczeniu: [" << Z1.zakres_od() << ", " << Z1.zakres_do() << "]" << std::endl;
+
+    std::cout << "--- Test 14: Redukcje i skrot (n=6) ---" << std::endl;
+    matrix R(6); R.losuj();
+    R.wstaw(2, 4, -7);
+    std::cout << R;
+    element_skrajny rmin = R.minimum();
+    element_skrajny rmax = R.maksimum();
+    std::cout << "Suma: " << R.suma() << ", slad: " << R.slad() << ", niezerowe: " << R.niezerowe() << std::endl;
+    std::cout << "Minimum " << rmin.wartosc << " w (" << rmin.wiersz << ", " << rmin.kolumna << "), maksimum "
+              << rmax.wartosc << " w (" << rmax.wiersz << ", " << rmax.kolumna << ")" << std::endl;
+    std::cout << "Norma L1: " << R.norma_l1() << ", norma Linf: " << R.norma_inf() << std::endl;
+    matrix RKopia(R);
+    RKopia.wstaw(0, 0, RKopia.pokaz(0, 0) + 1);
+    std::cout << "Skroty rowne: " << (R.skrot() == RKopia.skrot() ? "tak" : "nie")
+              << ", R == RKopia: " << (R == RKopia ? "tak" : "nie") << std::endl; // odrzucenie po skrotach
+
+    std::cout << "--- Test 15: Wyznacznik, rzad i rozklad LU (n=5) ---" << std::endl;
+    int tw[25] = { 2, -1,  0,  3,  1,
+                   4,  1,  5, -2,  0,
+                  -3,  2,  1,  0,  7,
+                   1,  0, -4,  6,  2,
+                   0,  3,  2, -1,  5 };
+    matrix W(5, tw);
+    rozklad_lu LU(W);
+    std::cout << "Wyznacznik (Bareiss): " << W.wyznacznik() << ", z rozkladu LU: " << LU.wyznacznik() << std::endl;
+    W.wiersz(4, &tw[5]);                               // wiersz 4 = wiersz 1
+    std::cout << "Rzad po powtorzeniu wiersza: " << W.rzad() << ", wyznacznik: " << W.wyznacznik() << std::endl;
+    matrix WD(30); WD.losuj();                         // wyznacznik rzedu 10^30 - poza zakresem 64 bitow
+    bool rzad_dokladny = false;
+    int rzad_wd = WD.rzad(&rzad_dokladny);
+    std::cout << "Wyznacznik losowej 30x30 (wielomodularnie): " << WD.wyznacznik()
+              << ", z rozkladu LU: " << rozklad_lu(WD).wyznacznik() << std::endl;
+    std::cout << "Rzad: " << rzad_wd << (rzad_dokladny ? " (dokladny)" : " (modulo p)") << std::endl;
+
+    std::cout << "--- Test 16: Duze strony i rownolegle wypelnianie (n=2048) ---" << std::endl;
+    ustaw_strony_duze(strony_duze::przezroczyste);     // domyslnie; jawne wymaga rezerwacji w systemie
+    matrix Duza(2048);                                    // bufor 16 MB - strony jeszcze niedotkniete
+    Duza.szachownica();                                   // pierwszy zapis rownolegle, wierszami
+    std::cout << "Suma szachownicy: " << Duza.suma() << " (oczekiwano " << 2048LL * 2048 / 2 << ")" << std::endl;
+    Duza.dowroc();
+    std::cout << "Szachownica po transpozycji bez zmian: " << (Duza.suma() == 2048LL * 2048 / 2 && Duza.pokaz(0, 1) == 1 ? "tak" : "nie") << std::endl;
+
     return 0;
 }
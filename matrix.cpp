@@ -1,20 +1,63 @@
 #include "matrix.h"
+#include "matrix_mod.h"
+#include "matrix_tuning.h"
+#include "matrix_gemm.h"
+#include "matrix_lu.h"
+#include "matrix_parallel.h"
 #include <cstdlib>
 #include <cmath>
 #include <algorithm>
+#include <climits>
+
+// --- Wypełnianie równoległe ---
+
+namespace {
+
+/**
+ * @brief Generator splitmix64: przesuwa stan i zwraca kolejną 64-bitową liczbę losową.
+ */
+inline unsigned long long splitmix64(unsigned long long& stan) {
+    unsigned long long z = (stan += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+} // namespace
+
+/**
+ * @brief Wykonuje f(i, wiersz) dla każdego wiersza macierzy, dzieląc wiersze między wątki.
+ * 
+ * Bufory są przydzielane bez dotykania stron (matrix_alloc.h), więc strona trafia do
+ * węzła NUMA wątku, który pierwszy do niej zapisze. Podział wierszy jest taki sam jak
+ * w rownolegle() używanym przez jądra obliczeniowe, dzięki czemu późniejsze
+ * równoległe operacje czytają głównie pamięć lokalną.
+ * 
+ * @param f Funkcja (int i, int* wiersz) wypełniająca n elementów wiersza i.
+ */
+template <typename F>
+void matrix::wypelnij_wiersze(F f) {
+    int* d = data.get();
+    int rozmiar = n;
+    rownolegle(0, rozmiar, watki_redukcji(static_cast<long long>(rozmiar) * rozmiar), [=](int od, int do_) {
+        for (int i = od; i < do_; ++i) f(i, d + static_cast<std::size_t>(i) * rozmiar);
+    });
+}
 
 // --- Konstruktory ---
 
 /**
  * @brief Domyślny konstruktor. Inicjalizuje macierz o rozmiarze 0.
  */
-matrix::matrix() : n(0), allocated_n(0), data(nullptr) {}
+matrix::matrix() : data(nullptr), n(0), allocated_n(0), zakres_min(0), zakres_max(0), widoki_zapisywalne(false),
+      skrot_pamiec(0) {}
 
 /**
  * @brief Konstruktor z parametrem rozmiaru. Alokuje pamięć dla macierzy n×n.
  * @param n Rozmiar macierzy (n x n). Jeśli n ≤ 0, macierz pozostaje pusta.
  */
-matrix::matrix(int n) : n(0), allocated_n(0), data(nullptr) {
+matrix::matrix(int n) : data(nullptr), n(0), allocated_n(0), zakres_min(0), zakres_max(0), widoki_zapisywalne(false),
+      skrot_pamiec(0) {
     alokuj(n);
 }
 
@@ -24,29 +67,83 @@ matrix::matrix(int n) : n(0), allocated_n(0), data(nullptr) {
  * @param t Wskaźnik na tablicę zawierającą n² elementów w porządku wiersz po wierszu.
  */
 matrix::matrix(int n, int* t) : matrix(n) {
-    for (int i = 0; i < n * n; ++i) {
-        data[i] = t[i];
-    }
+    if (this->n == 0) return;
+    wypelnij_wiersze([=](int i, int* w) { std::copy(t + i * n, t + (i + 1) * n, w); });
+    const_matrix_view v(data.get(), n, n, n);
+    int watki = watki_redukcji(static_cast<long long>(n) * n);
+    ustaw_zakres(::minimum(v, watki).wartosc, ::maksimum(v, watki).wartosc);
 }
 
 /**
  * @brief Konstruktor kopiujący. Wykonuje głęboką kopię danych macierzy.
  * @param m Macierz do skopiowania.
  */
-matrix::matrix(const matrix& m) : n(m.n), allocated_n(m.allocated_n) {
+matrix::matrix(const matrix& m)
+    : n(m.n), allocated_n(m.allocated_n), zakres_min(m.zakres_min), zakres_max(m.zakres_max),
+      widoki_zapisywalne(false), skrot_pamiec(0) {
     if (m.data) {
-        data = std::make_unique<int[]>(allocated_n * allocated_n);
-        for (int i = 0; i < n * n; ++i) {
-            data[i] = m.data[i];
-        }
+        data = przydziel_zera(static_cast<std::size_t>(allocated_n) * allocated_n);
+        const int* zrodlo = m.data.get();
+        int rozmiar = n;
+        wypelnij_wiersze([=](int i, int* w) { std::copy(zrodlo + i * rozmiar, zrodlo + (i + 1) * rozmiar, w); });
     }
 }
 
 /**
- * @brief Destruktor. Automatycznie zwalnia dynamicznie przydzieloną pamięć poprzez unique_ptr.
+ * @brief Konstruktor przenoszący. Przejmuje bufor macierzy źródłowej bez kopiowania.
+ * 
+ * Obserwatorzy nie są przenoszeni - pozostają przy (teraz pustej) macierzy źródłowej.
+ * Zakres wartości, informacja o widokach zapisywalnych i zapamiętany skrót
+ * przechodzą razem z buforem.
+ * 
+ * @param m Macierz źródłowa (po przeniesieniu pozostaje pusta).
+ */
+matrix::matrix(matrix&& m) noexcept
+    : data(std::move(m.data)), n(m.n), allocated_n(m.allocated_n), zakres_min(m.zakres_min),
+      zakres_max(m.zakres_max), widoki_zapisywalne(m.widoki_zapisywalne),
+      skrot_pamiec(m.skrot_pamiec.load(std::memory_order_relaxed)), wydane_widoki(std::move(m.wydane_widoki)) {
+    m.n = 0;
+    m.allocated_n = 0;
+    m.zakres_min = m.zakres_max = 0;
+    m.widoki_zapisywalne = false;
+    m.powiadom_o_zmianie();
+}
+
+/**
+ * @brief Przenoszący operator przypisania. Przejmuje bufor macierzy źródłowej bez kopiowania.
+ * @param m Macierz źródłowa (po przeniesieniu pozostaje pusta).
+ * @return Referencja do bieżącego obiektu.
+ */
+matrix& matrix::operator=(matrix&& m) noexcept {
+    if (this != &m) {
+        data = std::move(m.data);
+        n = m.n;
+        allocated_n = m.allocated_n;
+        zakres_min = m.zakres_min;
+        zakres_max = m.zakres_max;
+        widoki_zapisywalne = m.widoki_zapisywalne;
+        wydane_widoki = std::move(m.wydane_widoki);
+        std::uint64_t s = m.skrot_pamiec.load(std::memory_order_relaxed);
+        m.n = 0;
+        m.allocated_n = 0;
+        m.zakres_min = m.zakres_max = 0;
+        m.widoki_zapisywalne = false;
+        m.powiadom_o_zmianie();
+        powiadom_o_zmianie();
+        skrot_pamiec.store(s, std::memory_order_relaxed); // ta sama zawartość co w m
+    }
+    return *this;
+}
+
+/**
+ * @brief Destruktor. Automatycznie zwalnia dynamicznie przydzieloną pamięć poprzez unique_ptr
+ * i informuje obserwatorów o zniszczeniu macierzy.
  */
 matrix::~matrix() {
     // unique_ptr zwalnia pamięć automatycznie
+    std::vector<obserwator_macierzy*> do_powiadomienia;
+    do_powiadomienia.swap(obserwatorzy);
+    for (obserwator_macierzy* o : do_powiadomienia) o->po_zniszczeniu(*this);
 }
 
 // --- Metoda Alokuj ---
@@ -56,7 +153,8 @@ matrix::~matrix() {
  * 
  * Jeśli żądana pamięć jest większa niż dotychczas przydzielona, dokonywana jest realokacja.
  * W przeciwnym razie zmienia się tylko rozmiar logiczny macierzy.
- * Nowa pamięć jest zerowana dla bezpieczeństwa.
+ * Nowa pamięć jest wyzerowana już przy przydziale (przydziel_zera()), więc nie jest
+ * zerowana ponownie; ponownie użyty bufor tego samego rozmiaru zerowany jest równolegle.
  * 
  * @param req_n Żądany rozmiar macierzy (n x n).
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
@@ -64,11 +162,15 @@ matrix::~matrix() {
 matrix& matrix::alokuj(int req_n) {
     if (req_n <= 0) return *this;
 
+    bool swiezy = false;
     if (allocated_n < req_n) {
         // Jeśli mamy za mało pamięci, musimy przearanżować
         // unique_ptr automatycznie usunie starą tablicę przy przypisaniu nowej
-        data = std::make_unique<int[]>(req_n * req_n);
+        data = przydziel_zera(static_cast<std::size_t>(req_n) * req_n);
         allocated_n = req_n;
+        widoki_zapisywalne = false; // stare widoki wskazują na zwolniony bufor
+        wydane_widoki.reset();
+        swiezy = true;
     }
     // Jeśli allocated_n >= req_n, nie robimy nic (zostawiamy alokację),
     // tylko zmieniamy logiczny rozmiar n.
@@ -76,9 +178,13 @@ matrix& matrix::alokuj(int req_n) {
     
     // Opcjonalnie: zerowanie nowej pamięci dla bezpieczeństwa
     if(allocated_n == req_n) { 
-        for(int i=0; i<n*n; ++i) data[i] = 0;
+        if (!swiezy) wypelnij_wiersze([=](int, int* w) { std::fill(w, w + req_n, 0); });
+        ustaw_zakres(0, 0);
+    } else {
+        ustaw_zakres(INT_MIN, INT_MAX); // pozostałości poprzedniej zawartości
     }
 
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -92,7 +198,13 @@ matrix& matrix::alokuj(int req_n) {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::wstaw(int x, int y, int wartosc) {
-    if (x >= 0 && x < n && y >= 0 && y < n) data[x * n + y] = wartosc;
+    if (x >= 0 && x < n && y >= 0 && y < n) {
+        int stara = data[x * n + y];
+        data[x * n + y] = wartosc;
+        poszerz_zakres(wartosc, wartosc);
+        skrot_pamiec.store(0, std::memory_order_relaxed);
+        for (obserwator_macierzy* o : obserwatorzy) o->po_wstawieniu(*this, x, y, stara);
+    }
     return *this;
 }
 
@@ -116,13 +228,18 @@ int matrix::pokaz(int x, int y) const {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::dowroc() {
-    auto temp = std::make_unique<int[]>(n * n);
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < n; ++j) {
-            temp[j * n + i] = data[i * n + j];
-        }
-    }
-    data = std::move(temp);
+    if (n == 0) return *this;
+    bufor_int zrodlo = std::move(data);
+    data = przydziel_zera(static_cast<std::size_t>(n) * n);
+    allocated_n = n;
+    const int* z = zrodlo.get();
+    int rozmiar = n;
+    wypelnij_wiersze([=](int j, int* w) {
+        for (int i = 0; i < rozmiar; ++i) w[i] = z[i * rozmiar + j];
+    });
+    widoki_zapisywalne = false; // stare widoki wskazują na zwolniony bufor
+    wydane_widoki.reset();
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -130,11 +247,21 @@ matrix& matrix::dowroc() {
  * @brief Wypełnia macierz losowymi wartościami z zakresu [0, 9].
  * 
  * Każdy element macierzy otrzymuje losową wartość całkowitą z przedziału 0-9.
+ * Wiersze wypełniane są równolegle.
  * 
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::losuj() {
-    for (int i = 0; i < n * n; ++i) data[i] = rand() % 10;
+    // Jedno ziarno z rand() (srand() nadal steruje wynikiem); każdy wiersz ma własny
+    // generator splitmix64, więc wynik nie zależy od liczby wątków.
+    unsigned long long ziarno = (static_cast<unsigned long long>(rand()) << 32) ^ static_cast<unsigned long long>(rand());
+    wypelnij_wiersze([=](int i, int* w) {
+        unsigned long long stan = ziarno + static_cast<unsigned long long>(i);
+        stan = splitmix64(stan); // rozproszenie stanów sąsiednich wierszy
+        for (int j = 0; j < n; ++j) w[j] = static_cast<int>(splitmix64(stan) % 10);
+    });
+    ustaw_zakres(0, 9);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -148,12 +275,14 @@ matrix& matrix::losuj() {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::losuj(int x) {
-    for (int i = 0; i < n * n; ++i) data[i] = 0;
+    wypelnij_wiersze([=](int, int* w) { std::fill(w, w + n, 0); });
     for (int k = 0; k < x; ++k) {
         int r = rand() % n;
         int c = rand() % n;
         data[r * n + c] = rand() % 10;
     }
+    ustaw_zakres(0, 9);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -182,15 +311,17 @@ matrix& matrix::diagonalna(int* t) {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::diagonalna_k(int k, int* t) {
-    for (int i = 0; i < n * n; ++i) data[i] = 0;
-    
-    int idx = 0;
-    for (int i = 0; i < n; ++i) {
+    // Wiersz i zawiera element t[i - pierwszy], jeśli kolumna i + k mieści się w macierzy
+    int pierwszy = std::max(0, -k);
+    wypelnij_wiersze([=](int i, int* w) {
+        std::fill(w, w + n, 0);
         int j = i + k;
-        if (j >= 0 && j < n) {
-            data[i * n + j] = t[idx++];
-        }
-    }
+        if (j >= 0 && j < n) w[j] = t[i - pierwszy];
+    });
+
+    ustaw_zakres(0, 0);
+    for (int idx = 0; idx < n - std::abs(k); ++idx) poszerz_zakres(t[idx], t[idx]);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -202,7 +333,17 @@ matrix& matrix::diagonalna_k(int k, int* t) {
  */
 matrix& matrix::kolumna(int x, int* t) {
     if (x >= 0 && x < n) {
-        for (int i = 0; i < n; ++i) data[i * n + x] = t[i];
+        std::vector<int> stara;
+        if (!obserwatorzy.empty()) {
+            stara.resize(n);
+            for (int i = 0; i < n; ++i) stara[i] = data[i * n + x];
+        }
+        for (int i = 0; i < n; ++i) {
+            data[i * n + x] = t[i];
+            poszerz_zakres(t[i], t[i]);
+        }
+        skrot_pamiec.store(0, std::memory_order_relaxed);
+        for (obserwator_macierzy* o : obserwatorzy) o->po_kolumnie(*this, x, stara.data());
     }
     return *this;
 }
@@ -215,7 +356,14 @@ matrix& matrix::kolumna(int x, int* t) {
  */
 matrix& matrix::wiersz(int y, int* t) {
     if (y >= 0 && y < n) {
-        for (int i = 0; i < n; ++i) data[y * n + i] = t[i];
+        std::vector<int> stary;
+        if (!obserwatorzy.empty()) stary.assign(&data[y * n], &data[y * n] + n);
+        for (int i = 0; i < n; ++i) {
+            data[y * n + i] = t[i];
+            poszerz_zakres(t[i], t[i]);
+        }
+        skrot_pamiec.store(0, std::memory_order_relaxed);
+        for (obserwator_macierzy* o : obserwatorzy) o->po_wierszu(*this, y, stary.data());
     }
     return *this;
 }
@@ -225,9 +373,12 @@ matrix& matrix::wiersz(int y, int* t) {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::przekatna() {
-    for (int i = 0; i < n; ++i)
-        for (int j = 0; j < n; ++j)
-            data[i * n + j] = (i == j) ? 1 : 0;
+    wypelnij_wiersze([=](int i, int* w) {
+        std::fill(w, w + n, 0);
+        w[i] = 1;
+    });
+    ustaw_zakres(0, 1);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -236,9 +387,11 @@ matrix& matrix::przekatna() {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::pod_przekatna() {
-    for (int i = 0; i < n; ++i)
-        for (int j = 0; j < n; ++j)
-            data[i * n + j] = (i > j) ? 1 : 0;
+    wypelnij_wiersze([=](int i, int* w) {
+        for (int j = 0; j < n; ++j) w[j] = (i > j) ? 1 : 0;
+    });
+    ustaw_zakres(0, 1);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -247,9 +400,11 @@ matrix& matrix::pod_przekatna() {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::nad_przekatna() {
-    for (int i = 0; i < n; ++i)
-        for (int j = 0; j < n; ++j)
-            data[i * n + j] = (j > i) ? 1 : 0;
+    wypelnij_wiersze([=](int i, int* w) {
+        for (int j = 0; j < n; ++j) w[j] = (j > i) ? 1 : 0;
+    });
+    ustaw_zakres(0, 1);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -258,12 +413,365 @@ matrix& matrix::nad_przekatna() {
  * @return Referencja do bieżącego obiektu umożliwiająca łańcuchowanie operacji.
  */
 matrix& matrix::szachownica() {
-    for (int i = 0; i < n; ++i)
-        for (int j = 0; j < n; ++j)
-            data[i * n + j] = (i + j) % 2;
+    wypelnij_wiersze([=](int i, int* w) {
+        for (int j = 0; j < n; ++j) w[j] = (i + j) % 2;
+    });
+    ustaw_zakres(0, 1);
+    powiadom_o_zmianie();
     return *this;
 }
 
+// --- Redukcje ---
+
+/**
+ * @brief Suma wszystkich elementów.
+ * @return Suma w arytmetyce 64-bitowej (bez przepełnienia).
+ */
+long long matrix::suma() const {
+    return ::suma(widok(), watki_redukcji(static_cast<long long>(n) * n));
+}
+
+/**
+ * @brief Ślad macierzy - suma widoku diagonali o kroku kolumny n+1.
+ * @return Ślad w arytmetyce 64-bitowej.
+ */
+long long matrix::slad() const {
+    return ::suma(const_matrix_view(data.get(), n > 0 ? 1 : 0, n, n, n + 1), 1);
+}
+
+/**
+ * @brief Najmniejszy element macierzy i jego położenie.
+ * @return Pierwsze wystąpienie w porządku wierszowym ({0, -1, -1} dla pustej macierzy).
+ */
+element_skrajny matrix::minimum() const {
+    return ::minimum(widok(), watki_redukcji(static_cast<long long>(n) * n));
+}
+
+/**
+ * @brief Największy element macierzy i jego położenie.
+ * @return Pierwsze wystąpienie w porządku wierszowym ({0, -1, -1} dla pustej macierzy).
+ */
+element_skrajny matrix::maksimum() const {
+    return ::maksimum(widok(), watki_redukcji(static_cast<long long>(n) * n));
+}
+
+/**
+ * @brief Norma ‖A‖₁ - największa suma wartości bezwzględnych w kolumnie.
+ */
+long long matrix::norma_l1() const {
+    return ::norma_l1(widok(), watki_redukcji(static_cast<long long>(n) * n));
+}
+
+/**
+ * @brief Norma ‖A‖∞ - największa suma wartości bezwzględnych w wierszu.
+ */
+long long matrix::norma_inf() const {
+    return ::norma_inf(widok(), watki_redukcji(static_cast<long long>(n) * n));
+}
+
+/**
+ * @brief Liczba elementów różnych od zera.
+ */
+long long matrix::niezerowe() const {
+    return ::niezerowe(widok(), watki_redukcji(static_cast<long long>(n) * n));
+}
+
+/**
+ * @brief 64-bitowy skrót zawartości macierzy.
+ * 
+ * Obliczony skrót zapamiętywany jest w polu atomowym, więc równoczesne wywołania
+ * na tej samej stałej macierzy (np. z zadań asynchronicznych) są bezpieczne.
+ * Dopóki istnieją widoki zapisywalne, zapis przez nie mógłby nie unieważnić
+ * skrótu, dlatego nie jest on wtedy zapamiętywany.
+ * 
+ * @return Skrót różny od 0; równe macierze mają równe skróty.
+ */
+std::uint64_t matrix::skrot() const {
+    std::uint64_t s = skrot_pamiec.load(std::memory_order_relaxed);
+    if (s != 0) return s;
+    s = ::skrot(widok(), watki_redukcji(static_cast<long long>(n) * n));
+    if (!widoki_zapisywalne) skrot_pamiec.store(s, std::memory_order_relaxed);
+    return s;
+}
+
+// --- Wyznacznik i rząd ---
+
+/**
+ * @brief Dokładny wyznacznik macierzy dowolnej wielkości.
+ * @return Wyznacznik (Bareiss lub metoda wielomodularna).
+ */
+duza_liczba matrix::wyznacznik() const {
+    return wyznacznik_dokladny(widok(), liczba_watkow_sprzetowych());
+}
+
+/**
+ * @brief Rząd macierzy (eliminacja Bareissa, w razie przepełnienia - modulo p).
+ * @param dokladny Jeśli nie nullptr, otrzymuje false, gdy użyto obliczeń modulo p.
+ * @return Rząd macierzy.
+ */
+int matrix::rzad(bool* dokladny) const {
+    int wynik;
+    bool ok = rzad_bareiss(widok(), wynik, liczba_watkow_sprzetowych());
+    if (!ok) wynik = std::max(rzad_mod(widok(), 2147483647), rzad_mod(widok(), 1000000007));
+    if (dokladny) *dokladny = ok;
+    return wynik;
+}
+
+// --- Obserwatorzy ---
+
+/**
+ * @brief Rejestruje obserwatora zmian macierzy.
+ * @param o Obserwator (nie jest przejmowany na własność; ponowna rejestracja jest ignorowana).
+ */
+void matrix::subskrybuj(obserwator_macierzy* o) {
+    if (o && std::find(obserwatorzy.begin(), obserwatorzy.end(), o) == obserwatorzy.end()) {
+        obserwatorzy.push_back(o);
+    }
+}
+
+/**
+ * @brief Wyrejestrowuje obserwatora zmian macierzy.
+ * @param o Obserwator zarejestrowany wcześniej przez subskrybuj().
+ */
+void matrix::anuluj_subskrypcje(obserwator_macierzy* o) {
+    obserwatorzy.erase(std::remove(obserwatorzy.begin(), obserwatorzy.end(), o), obserwatorzy.end());
+}
+
+/**
+ * @brief Informuje obserwatorów o dowolnej zmianie zawartości macierzy.
+ * 
+ * Wywoływana przez wszystkie metody modyfikujące całą macierz. Zapisy wykonane
+ * przez widoki nie są śledzone - po nich należy wywołać tę metodę samodzielnie.
+ * Unieważnia także zapamiętany skrót zawartości, a jeśli wydano widoki zapisywalne,
+ * przywraca śledzenie zakresu (przelicz_zakres()).
+ */
+void matrix::powiadom_o_zmianie() {
+    skrot_pamiec.store(0, std::memory_order_relaxed);
+    if (widoki_zapisywalne) przelicz_zakres();
+    for (obserwator_macierzy* o : obserwatorzy) o->po_zmianie(*this);
+}
+
+// --- Zakres wartości ---
+
+/**
+ * @brief Dolne ograniczenie wartości elementów.
+ * @return Liczba nie większa niż najmniejszy element (INT_MIN, jeśli zakres jest nieznany).
+ */
+int matrix::zakres_od() const {
+    return zakres_min;
+}
+
+/**
+ * @brief Górne ograniczenie wartości elementów.
+ * @return Liczba nie mniejsza niż największy element (INT_MAX, jeśli zakres jest nieznany).
+ */
+int matrix::zakres_do() const {
+    return zakres_max;
+}
+
+/**
+ * @brief Wyznacza zakres wartości od nowa na podstawie zawartości macierzy.
+ * 
+ * Jeśli wydane widoki zapisywalne już nie istnieją, ich zapisy są zakończone:
+ * śledzenie zakresu i zapamiętywanie skrótu zostają przywrócone do czasu wydania
+ * kolejnego widoku zapisywalnego. Jeśli któryś wciąż istnieje, mógłby później
+ * zapisać wartość spoza wyznaczonego zakresu, więc zakres pozostaje nieznany.
+ */
+void matrix::przelicz_zakres() {
+    skrot_pamiec.store(0, std::memory_order_relaxed);
+    widoki_zapisywalne = !wydane_widoki.expired();
+    if (widoki_zapisywalne) {
+        ustaw_zakres(INT_MIN, INT_MAX);
+        return;
+    }
+    const_matrix_view v = static_cast<const matrix&>(*this).widok();
+    int watki = watki_redukcji(static_cast<long long>(n) * n);
+    ustaw_zakres(::minimum(v, watki).wartosc, ::maksimum(v, watki).wartosc);
+}
+
+/**
+ * @brief Ustawia zakres wartości po operacji, która nadpisała całą macierz.
+ * 
+ * Granice wychodzące poza int oznaczają możliwe przepełnienie - wtedy zakres staje się
+ * nieznany. Nieznany pozostaje także od wydania widoku zapisywalnego do przelicz_zakres()
+ * wywołanego po zniszczeniu wszystkich takich widoków.
+ * 
+ * @param od Nowe dolne ograniczenie.
+ * @param do_ Nowe górne ograniczenie.
+ */
+void matrix::ustaw_zakres(long long od, long long do_) {
+    if (widoki_zapisywalne || od < INT_MIN || do_ > INT_MAX) {
+        zakres_min = INT_MIN;
+        zakres_max = INT_MAX;
+        return;
+    }
+    zakres_min = static_cast<int>(od);
+    zakres_max = static_cast<int>(do_);
+}
+
+/**
+ * @brief Poszerza zakres wartości tak, aby obejmował przedział [od, do_].
+ * @param od Dolna granica nowych wartości.
+ * @param do_ Górna granica nowych wartości.
+ */
+void matrix::poszerz_zakres(long long od, long long do_) {
+    ustaw_zakres(std::min<long long>(zakres_min, od), std::max<long long>(zakres_max, do_));
+}
+
+/**
+ * @brief Przelicza zakres wartości po pomnożeniu wszystkich elementów przez a.
+ * @param a Mnożnik (ujemny zamienia granice miejscami).
+ */
+void matrix::przeskaluj_zakres(int a) {
+    long long x = static_cast<long long>(zakres_min) * a;
+    long long y = static_cast<long long>(zakres_max) * a;
+    ustaw_zakres(std::min(x, y), std::max(x, y));
+}
+
+/**
+ * @brief Widok na całą macierz do użytku wewnętrznego.
+ * 
+ * W przeciwieństwie do widok() nie unieważnia zakresu wartości - metody klasy
+ * same ustawiają zakres po zapisie.
+ * 
+ * @return Widok n×n o kroku wiersza n.
+ */
+matrix_view matrix::widok_wewnetrzny() {
+    return matrix_view(data.get(), n, n, n);
+}
+
+/**
+ * @brief Przygotowuje wydanie widoku zapisywalnego.
+ * 
+ * Wyłącza śledzenie zakresu i zapamiętywanie skrótu, a następnie zwraca znacznik
+ * wspólny dla wszystkich żyjących widoków zapisywalnych bieżącego bufora.
+ * 
+ * @return Znacznik do umieszczenia w wydawanym widoku.
+ */
+std::shared_ptr<void> matrix::wydaj_znacznik() {
+    widoki_zapisywalne = true;
+    skrot_pamiec.store(0, std::memory_order_relaxed);
+    ustaw_zakres(INT_MIN, INT_MAX);
+    std::shared_ptr<void> z = wydane_widoki.lock();
+    if (!z) {
+        z = std::make_shared<char>(0);
+        wydane_widoki = z;
+    }
+    return z;
+}
+
+// --- Widoki ---
+
+/**
+ * @brief Tworzy widok na całą macierz.
+ * 
+ * Zapisy przez widok nie są widoczne dla śledzenia zakresu wartości, dlatego od tej
+ * chwili (do wymiany bufora albo powiadom_o_zmianie() lub przelicz_zakres()
+ * wywołanych, gdy nie istnieje już żaden widok zapisywalny) zakres macierzy jest
+ * traktowany jako nieznany.
+ * 
+ * @return Widok n×n o kroku wiersza n.
+ */
+matrix_view matrix::widok() {
+    return matrix_view(data.get(), n, n, n, 1, wydaj_znacznik());
+}
+
+/**
+ * @brief Tworzy widok tylko do odczytu na całą macierz.
+ * @return Widok n×n o kroku wiersza n.
+ */
+const_matrix_view matrix::widok() const {
+    return const_matrix_view(data.get(), n, n, n);
+}
+
+/**
+ * @brief Tworzy widok na prostokątny blok macierzy bez kopiowania danych.
+ * @param x Wiersz lewego górnego rogu bloku.
+ * @param y Kolumna lewego górnego rogu bloku.
+ * @param h Liczba wierszy bloku.
+ * @param w Liczba kolumn bloku.
+ * @return Widok na blok przycięty do granic macierzy (pusty, jeśli (x, y) jest poza zakresem).
+ */
+matrix_view matrix::blok(int x, int y, int h, int w) {
+    return widok().blok(x, y, h, w);
+}
+
+/**
+ * @brief Tworzy widok tylko do odczytu na prostokątny blok macierzy.
+ * @param x Wiersz lewego górnego rogu bloku.
+ * @param y Kolumna lewego górnego rogu bloku.
+ * @param h Liczba wierszy bloku.
+ * @param w Liczba kolumn bloku.
+ * @return Widok na blok przycięty do granic macierzy.
+ */
+const_matrix_view matrix::blok(int x, int y, int h, int w) const {
+    return widok().blok(x, y, h, w);
+}
+
+/**
+ * @brief Tworzy widok 1×n na wiersz macierzy.
+ * @param y Indeks wiersza (0-based).
+ * @return Widok na wiersz lub widok pusty, jeśli indeks jest poza zakresem.
+ */
+matrix_view matrix::wiersz_widok(int y) {
+    return widok().wiersz(y);
+}
+
+/**
+ * @brief Tworzy widok tylko do odczytu 1×n na wiersz macierzy.
+ * @param y Indeks wiersza (0-based).
+ * @return Widok na wiersz lub widok pusty, jeśli indeks jest poza zakresem.
+ */
+const_matrix_view matrix::wiersz_widok(int y) const {
+    return widok().wiersz(y);
+}
+
+/**
+ * @brief Tworzy widok n×1 na kolumnę macierzy.
+ * @param x Indeks kolumny (0-based).
+ * @return Widok na kolumnę lub widok pusty, jeśli indeks jest poza zakresem.
+ */
+matrix_view matrix::kolumna_widok(int x) {
+    return widok().kolumna(x);
+}
+
+/**
+ * @brief Tworzy widok tylko do odczytu n×1 na kolumnę macierzy.
+ * @param x Indeks kolumny (0-based).
+ * @return Widok na kolumnę lub widok pusty, jeśli indeks jest poza zakresem.
+ */
+const_matrix_view matrix::kolumna_widok(int x) const {
+    return widok().kolumna(x);
+}
+
+/**
+ * @brief Tworzy widok 1×(n-|k|) na diagonalę przesuniętą o k pozycji.
+ * 
+ * Kolejne elementy diagonali leżą w pamięci co n+1 pozycji, więc diagonala
+ * jest zwykłym widokiem jednowierszowym o kroku kolumny n+1.
+ * 
+ * @param k Przesunięcie diagonali (dodatnie - powyżej głównej, ujemne - poniżej).
+ * @return Widok o kroku kolumny n+1 lub widok pusty, jeśli |k| ≥ n.
+ */
+matrix_view matrix::przekatna_widok(int k) {
+    int dlugosc = n - std::abs(k);
+    if (dlugosc <= 0) return matrix_view();
+    int poczatek = (k >= 0) ? k : -k * n;
+    return matrix_view(data.get() + poczatek, 1, dlugosc, n, n + 1, wydaj_znacznik());
+}
+
+/**
+ * @brief Tworzy widok tylko do odczytu 1×(n-|k|) na diagonalę przesuniętą o k pozycji.
+ * @param k Przesunięcie diagonali (dodatnie - powyżej głównej, ujemne - poniżej).
+ * @return Widok o kroku kolumny n+1 lub widok pusty, jeśli |k| ≥ n.
+ */
+const_matrix_view matrix::przekatna_widok(int k) const {
+    int dlugosc = n - std::abs(k);
+    if (dlugosc <= 0) return const_matrix_view();
+    int poczatek = (k >= 0) ? k : -k * n;
+    return const_matrix_view(data.get() + poczatek, 1, dlugosc, n, n + 1);
+}
+
 // --- Operatory ---
 
 /**
@@ -271,12 +779,12 @@ matrix& matrix::szachownica() {
  * @param m Macierz do dodania.
  * @return Nowa macierz będąca sumą dwóch macierzy. Zwraca macierz zerową jeśli rozmiary się nie zgadzają.
  */
-matrix matrix::operator+(const matrix& m) {
+matrix matrix::operator+(const matrix& m) const {
     matrix temp(n);
     if (n != m.n) return temp;
-    for (int i = 0; i < n * n; ++i) {
-        temp.data[i] = data[i] + m.data[i];
-    }
+    dodaj(temp.widok_wewnetrzny(), widok(), m.widok());
+    temp.ustaw_zakres(static_cast<long long>(zakres_min) + m.zakres_min,
+                      static_cast<long long>(zakres_max) + m.zakres_max);
     return temp;
 }
 
@@ -284,22 +792,30 @@ matrix matrix::operator+(const matrix& m) {
  * @brief Mnoży dwie macierze (mnożenie macierzowe).
  * 
  * Wynikiem jest macierz C, gdzie C[i][j] = Σ(k=0 to n-1) A[i][k] × B[k][j]
+ * Algorytm (naiwny, blokowy, Strassen), rozmiar kafelka i liczba wątków
+ * wybierane są dla rozmiaru n przez strojenie (matrix_tuning.h). Jeśli śledzone
+ * zakresy wartości obu macierzy gwarantują brak przepełnienia w arytmetyce 8- lub
+ * 16-bitowej, używane jest wąskie jądro SIMD (mnoz_waskie).
  * 
  * @param m Macierz do pomnożenia.
  * @return Nowa macierz będąca iloczynem dwóch macierzy. Zwraca macierz zerową jeśli rozmiary się nie zgadzają.
  */
-matrix matrix::operator*(const matrix& m) {
+matrix matrix::operator*(const matrix& m) const {
     matrix temp(n);
     if (n != m.n) return temp;
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < n; ++j) {
-            int sum = 0;
-            for (int k = 0; k < n; ++k) {
-                sum += data[i * n + k] * m.data[k * n + j];
-            }
-            temp.data[i * n + j] = sum;
-        }
+    if (!mnoz_waskie(temp.widok_wewnetrzny(), widok(), m.widok(), zakres_min, zakres_max,
+                     m.zakres_min, m.zakres_max, strojenie::parametry(n).watki)) {
+        mnoz_dostrojone(temp.widok_wewnetrzny(), widok(), m.widok());
     }
+    // Każdy element wyniku to suma n iloczynów z przedziału [pmin, pmax]
+    long long p1 = static_cast<long long>(zakres_min) * m.zakres_min;
+    long long p2 = static_cast<long long>(zakres_min) * m.zakres_max;
+    long long p3 = static_cast<long long>(zakres_max) * m.zakres_min;
+    long long p4 = static_cast<long long>(zakres_max) * m.zakres_max;
+    long double pmin = std::min(std::min(p1, p2), std::min(p3, p4));
+    long double pmax = std::max(std::max(p1, p2), std::max(p3, p4));
+    if (pmin * n < INT_MIN || pmax * n > INT_MAX) temp.ustaw_zakres(INT_MIN, INT_MAX);
+    else temp.ustaw_zakres(static_cast<long long>(pmin) * n, static_cast<long long>(pmax) * n);
     return temp;
 }
 
@@ -311,6 +827,7 @@ matrix matrix::operator*(const matrix& m) {
 matrix matrix::operator+(int a) {
     matrix temp(*this);
     for (int i = 0; i < n * n; ++i) temp.data[i] += a;
+    temp.ustaw_zakres(static_cast<long long>(zakres_min) + a, static_cast<long long>(zakres_max) + a);
     return temp;
 }
 
@@ -322,6 +839,7 @@ matrix matrix::operator+(int a) {
 matrix matrix::operator*(int a) {
     matrix temp(*this);
     for (int i = 0; i < n * n; ++i) temp.data[i] *= a;
+    temp.przeskaluj_zakres(a);
     return temp;
 }
 
@@ -333,6 +851,88 @@ matrix matrix::operator*(int a) {
 matrix matrix::operator-(int a) {
     matrix temp(*this);
     for (int i = 0; i < n * n; ++i) temp.data[i] -= a;
+    temp.ustaw_zakres(static_cast<long long>(zakres_min) - a, static_cast<long long>(zakres_max) - a);
+    return temp;
+}
+
+// --- Arytmetyka modularna ---
+
+/**
+ * @brief Mnoży dwie macierze modulo p (dokładnie, bez przepełnienia int).
+ * @param m Macierz do pomnożenia.
+ * @param p Moduł, p ≥ 2.
+ * @return Nowa macierz z elementami z przedziału [0, p). Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+ */
+matrix matrix::mnoz_mod(const matrix& m, int p) const {
+    matrix temp(n);
+    if (n != m.n || p < 2) return temp;
+    ::mnoz_mod(temp.widok_wewnetrzny(), widok(), m.widok(), p, strojenie::parametry(n).watki);
+    temp.ustaw_zakres(0, p - 1);
+    return temp;
+}
+
+/**
+ * @brief Podnosi macierz do potęgi k modulo p (szybkie potęgowanie przez podnoszenie do kwadratu).
+ * 
+ * Wykonuje O(log k) mnożeń modularnych; pośrednie wyniki pozostają w [0, p),
+ * więc wynik jest dokładny dla dowolnie dużego k.
+ * 
+ * @param k Wykładnik (k = 0 daje macierz jednostkową).
+ * @param p Moduł, p ≥ 2.
+ * @return Nowa macierz A^k mod p. Zwraca macierz zerową jeśli p < 2.
+ */
+matrix matrix::potega_mod(unsigned long long k, int p) const {
+    matrix wynik(n);
+    if (p < 2) return wynik;
+    wynik.przekatna();
+    matrix podstawa = dodaj_mod(matrix(n), p);
+    while (k > 0) {
+        if (k & 1ULL) wynik = wynik.mnoz_mod(podstawa, p);
+        k >>= 1;
+        if (k > 0) podstawa = podstawa.mnoz_mod(podstawa, p);
+    }
+    return wynik;
+}
+
+/**
+ * @brief Dodaje dwie macierze element po elemencie modulo p.
+ * @param m Macierz do dodania.
+ * @param p Moduł, p ≥ 2.
+ * @return Nowa macierz (A + m) mod p. Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+ */
+matrix matrix::dodaj_mod(const matrix& m, int p) const {
+    matrix temp(n);
+    if (n != m.n || p < 2) return temp;
+    ::dodaj_mod(temp.widok_wewnetrzny(), widok(), m.widok(), p);
+    temp.ustaw_zakres(0, p - 1);
+    return temp;
+}
+
+/**
+ * @brief Odejmuje dwie macierze element po elemencie modulo p.
+ * @param m Macierz do odjęcia.
+ * @param p Moduł, p ≥ 2.
+ * @return Nowa macierz (A - m) mod p. Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+ */
+matrix matrix::odejmij_mod(const matrix& m, int p) const {
+    matrix temp(n);
+    if (n != m.n || p < 2) return temp;
+    ::odejmij_mod(temp.widok_wewnetrzny(), widok(), m.widok(), p);
+    temp.ustaw_zakres(0, p - 1);
+    return temp;
+}
+
+/**
+ * @brief Mnoży dwie macierze element po elemencie (iloczyn Hadamarda) modulo p.
+ * @param m Macierz do pomnożenia.
+ * @param p Moduł, p ≥ 2.
+ * @return Nowa macierz (A ∘ m) mod p. Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+ */
+matrix matrix::hadamard_mod(const matrix& m, int p) const {
+    matrix temp(n);
+    if (n != m.n || p < 2) return temp;
+    ::hadamard_mod(temp.widok_wewnetrzny(), widok(), m.widok(), p);
+    temp.ustaw_zakres(0, p - 1);
     return temp;
 }
 
@@ -342,6 +942,8 @@ matrix matrix::operator-(int a) {
  */
 matrix& matrix::operator++(int) {
     for (int i = 0; i < n * n; ++i) data[i]++;
+    ustaw_zakres(static_cast<long long>(zakres_min) + 1, static_cast<long long>(zakres_max) + 1);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -351,6 +953,8 @@ matrix& matrix::operator++(int) {
  */
 matrix& matrix::operator--(int) {
     for (int i = 0; i < n * n; ++i) data[i]--;
+    ustaw_zakres(static_cast<long long>(zakres_min) - 1, static_cast<long long>(zakres_max) - 1);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -361,6 +965,8 @@ matrix& matrix::operator--(int) {
  */
 matrix& matrix::operator+=(int a) {
     for (int i = 0; i < n * n; ++i) data[i] += a;
+    ustaw_zakres(static_cast<long long>(zakres_min) + a, static_cast<long long>(zakres_max) + a);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -371,6 +977,8 @@ matrix& matrix::operator+=(int a) {
  */
 matrix& matrix::operator-=(int a) {
     for (int i = 0; i < n * n; ++i) data[i] -= a;
+    ustaw_zakres(static_cast<long long>(zakres_min) - a, static_cast<long long>(zakres_max) - a);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -381,6 +989,8 @@ matrix& matrix::operator-=(int a) {
  */
 matrix& matrix::operator*=(int a) {
     for (int i = 0; i < n * n; ++i) data[i] *= a;
+    przeskaluj_zakres(a);
+    powiadom_o_zmianie();
     return *this;
 }
 
@@ -392,19 +1002,25 @@ matrix& matrix::operator*=(int a) {
 matrix& matrix::operator()(double val) {
     int intPart = static_cast<int>(val);
     for (int i = 0; i < n * n; ++i) data[i] += intPart;
+    ustaw_zakres(static_cast<long long>(zakres_min) + intPart, static_cast<long long>(zakres_max) + intPart);
+    powiadom_o_zmianie();
     return *this;
 }
 
 /**
  * @brief Porównuje dwie macierze na równość.
  * @param m Macierz do porównania.
+ * 
+ * Różne zapamiętane skróty pozwalają zwrócić false w czasie O(1); równe skróty
+ * (lub ich brak) wymagają porównania wszystkich elementów.
+ * 
  * @return true jeśli macierze są równe (wszystkie elementy identyczne), false w przeciwnym razie.
  */
-bool matrix::operator==(const matrix& m) {
-    if (n != m.n) return false;
-    for (int i = 0; i < n * n; ++i)
-        if (data[i] != m.data[i]) return false;
-    return true;
+bool matrix::operator==(const matrix& m) const {
+    std::uint64_t s1 = skrot_pamiec.load(std::memory_order_relaxed);
+    std::uint64_t s2 = m.skrot_pamiec.load(std::memory_order_relaxed);
+    if (s1 != 0 && s2 != 0 && s1 != s2) return false;
+    return rowne(widok(), m.widok());
 }
 
 /**
@@ -412,11 +1028,8 @@ bool matrix::operator==(const matrix& m) {
  * @param m Macierz do porównania.
  * @return true jeśli wszystkie elementy bieżącej macierzy są większe od odpowiadających elementów macierzy m.
  */
-bool matrix::operator>(const matrix& m) {
-    if (n != m.n) return false;
-    for (int i = 0; i < n * n; ++i)
-        if (data[i] <= m.data[i]) return false;
-    return true;
+bool matrix::operator>(const matrix& m) const {
+    return wieksze(widok(), m.widok());
 }
 
 /**
@@ -424,11 +1037,8 @@ bool matrix::operator>(const matrix& m) {
  * @param m Macierz do porównania.
  * @return true jeśli wszystkie elementy bieżącej macierzy są mniejsze od odpowiadających elementów macierzy m.
  */
-bool matrix::operator<(const matrix& m) {
-    if (n != m.n) return false;
-    for (int i = 0; i < n * n; ++i)
-        if (data[i] >= m.data[i]) return false;
-    return true;
+bool matrix::operator<(const matrix& m) const {
+    return mniejsze(widok(), m.widok());
 }
 
 // --- Funkcje Zaprzyjaźnione ---
@@ -458,6 +1068,7 @@ matrix operator*(int a, matrix& m) { return m * a; }
 matrix operator-(int a, matrix& m) {
     matrix temp(m.n);
     for (int i = 0; i < m.n * m.n; ++i) temp.data[i] = a - m.data[i];
+    temp.ustaw_zakres(static_cast<long long>(a) - m.zakres_max, static_cast<long long>(a) - m.zakres_min);
     return temp;
 }
 
@@ -471,7 +1082,7 @@ matrix operator-(int a, matrix& m) {
  * @param m Macierz do wypisania.
  * @return Referencja do strumienia wyjścia.
  */
-std::ostream& operator<<(std::ostream& o, matrix& m) {
+std::ostream& operator<<(std::ostream& o, const matrix& m) {
     for (int i = 0; i < m.n; ++i) {
         o << "| ";
         for (int j = 0; j < m.n; ++j) {
@@ -4,22 +4,101 @@
 #include <iostream>
 #include <memory>
 #include <iomanip>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "matrix_view.h"
+#include "matrix_reduce.h"
+#include "matrix_alloc.h"
+#include "matrix_bigint.h"
+
+class matrix;
+
+/**
+ * @class obserwator_macierzy
+ * @brief Interfejs odbiorcy powiadomień o zmianach zawartości macierzy.
+ *
+ * Metody wywoływane są po wykonaniu zmiany. Szczegółowe powiadomienia (wstaw, wiersz,
+ * kolumna) przekazują poprzednie wartości, co pozwala aktualizować wyniki pochodne
+ * przyrostowo; domyślnie przekierowują do po_zmianie().
+ */
+class obserwator_macierzy {
+public:
+    virtual ~obserwator_macierzy() = default;
+
+    /**
+     * @brief Dowolna zmiana zawartości lub rozmiaru macierzy.
+     * @param m Zmieniona macierz.
+     */
+    virtual void po_zmianie(const matrix& m) = 0;
+
+    /**
+     * @brief Zmiana jednego elementu przez wstaw().
+     * @param m Zmieniona macierz.
+     * @param x Indeks wiersza.
+     * @param y Indeks kolumny.
+     * @param stara Poprzednia wartość elementu.
+     */
+    virtual void po_wstawieniu(const matrix& m, int x, int y, int stara) { (void)x; (void)y; (void)stara; po_zmianie(m); }
+
+    /**
+     * @brief Zastąpienie wiersza przez wiersz().
+     * @param m Zmieniona macierz.
+     * @param y Indeks wiersza.
+     * @param stary Poprzednia zawartość wiersza (n elementów, ważna tylko w trakcie wywołania).
+     */
+    virtual void po_wierszu(const matrix& m, int y, const int* stary) { (void)y; (void)stary; po_zmianie(m); }
+
+    /**
+     * @brief Zastąpienie kolumny przez kolumna().
+     * @param m Zmieniona macierz.
+     * @param x Indeks kolumny.
+     * @param stara Poprzednia zawartość kolumny (n elementów, ważna tylko w trakcie wywołania).
+     */
+    virtual void po_kolumnie(const matrix& m, int x, const int* stara) { (void)x; (void)stara; po_zmianie(m); }
+
+    /**
+     * @brief Macierz jest niszczona; obserwator nie może się już do niej odwoływać.
+     * @param m Niszczona macierz.
+     */
+    virtual void po_zniszczeniu(const matrix& m) { (void)m; }
+};
 
 /**
  * @class matrix
  * @brief Klasa reprezentująca macierz kwadratową n×n z dynamicznym zarządzaniem pamięcią.
  * 
  * Klasa matrix udostępnia operacje na macierzach kwadratowych, w tym:
- * - zarządzanie pamięcią za pomocą inteligentnych wskaźników,
+ * - zarządzanie pamięcią za pomocą inteligentnych wskaźników (bufory zerowane leniwie
+ *   przez system, opcjonalnie na dużych stronach - matrix_alloc.h),
  * - operacje arytmetyczne (dodawanie, mnożenie),
  * - algorytmy wypełniania (diagonalna, szachownica itp.),
- * - operatory porównania i modyfikujące.
+ * - operatory porównania i modyfikujące,
+ * - dokładną arytmetykę modulo p (mnożenie, potęgowanie, operacje element po elemencie),
+ * - nieposiadające widoki (matrix_view) na bloki, wiersze, kolumny i diagonale,
+ * - powiadamianie obserwatorów (obserwator_macierzy) o zmianach,
+ * - śledzenie zakresu wartości, które pozwala mnożyć w arytmetyce 8/16-bitowej,
+ * - równoległe redukcje (suma, ślad, minimum, maksimum, normy) i skrót zawartości,
+ * - dokładny wyznacznik dowolnej wielkości i rząd (Bareiss, metoda wielomodularna, matrix_lu.h).
  */
 class matrix {
 private:
-    std::unique_ptr<int[]> data; ///< Inteligentny wskaźnik do tablicy elementów macierzy
+    bufor_int data;              ///< Inteligentny wskaźnik do tablicy elementów macierzy
     int n;                       ///< Aktualny rozmiar logiczny macierzy (n x n)
     int allocated_n;             ///< Rozmiar fizycznie zaalokowanej pamięci
+    std::vector<obserwator_macierzy*> obserwatorzy; ///< Odbiorcy powiadomień o zmianach (niekopiowani)
+    int zakres_min;              ///< Dolne ograniczenie wartości elementów (INT_MIN - nieznane)
+    int zakres_max;              ///< Górne ograniczenie wartości elementów (INT_MAX - nieznane)
+    bool widoki_zapisywalne;     ///< true, jeśli wydano widok zapisywalny na bieżący bufor
+    mutable std::atomic<std::uint64_t> skrot_pamiec; ///< Zapamiętany skrót zawartości (0 - nieobliczony)
+    std::weak_ptr<void> wydane_widoki; ///< Znacznik żyjących widoków zapisywalnych (wygasły - brak)
+
+    void ustaw_zakres(long long od, long long do_);
+    void poszerz_zakres(long long od, long long do_);
+    void przeskaluj_zakres(int a);
+    matrix_view widok_wewnetrzny();
+    std::shared_ptr<void> wydaj_znacznik();
+    template <typename F> void wypelnij_wiersze(F f);
 
 public:
     // --- Konstruktory i Destruktor ---
@@ -47,6 +126,19 @@ public:
      * @param m Macierz do skopiowania.
      */
     matrix(const matrix& m);
+
+    /**
+     * @brief Konstruktor przenoszący. Przejmuje bufor macierzy źródłowej bez kopiowania.
+     * @param m Macierz źródłowa (po przeniesieniu pozostaje pusta).
+     */
+    matrix(matrix&& m) noexcept;
+
+    /**
+     * @brief Przenoszący operator przypisania. Przejmuje bufor macierzy źródłowej bez kopiowania.
+     * @param m Macierz źródłowa (po przeniesieniu pozostaje pusta).
+     * @return Referencja do bieżącego obiektu.
+     */
+    matrix& operator=(matrix&& m) noexcept;
     
     /**
      * @brief Destruktor. Automatycznie zwalnia dynamicznie przydzieloną pamięć.
@@ -157,6 +249,210 @@ public:
      */
     matrix& szachownica();
 
+    // --- Zakres wartości ---
+
+    /**
+     * @brief Dolne ograniczenie wartości elementów śledzone przez wypełnienia i arytmetykę.
+     * @return Liczba nie większa niż najmniejszy element (INT_MIN, jeśli zakres jest nieznany).
+     */
+    int zakres_od() const;
+
+    /**
+     * @brief Górne ograniczenie wartości elementów śledzone przez wypełnienia i arytmetykę.
+     * @return Liczba nie mniejsza niż największy element (INT_MAX, jeśli zakres jest nieznany).
+     */
+    int zakres_do() const;
+
+    /**
+     * @brief Wyznacza zakres wartości od nowa (równoległe minimum i maksimum).
+     * 
+     * Należy ją wywołać (bezpośrednio lub przez powiadom_o_zmianie()) po zakończeniu
+     * zapisów przez widoki - przywraca śledzenie zakresu wyłączone ich wydaniem.
+     * Dopóki istnieje którykolwiek wydany widok zapisywalny (lub jego kopia, blok,
+     * wiersz, kolumna), zakres pozostaje nieznany.
+     */
+    void przelicz_zakres();
+
+    // --- Redukcje ---
+
+    /**
+     * @brief Suma wszystkich elementów.
+     * @return Suma w arytmetyce 64-bitowej (bez przepełnienia).
+     */
+    long long suma() const;
+
+    /**
+     * @brief Ślad macierzy (suma elementów głównej diagonali).
+     * @return Ślad w arytmetyce 64-bitowej.
+     */
+    long long slad() const;
+
+    /**
+     * @brief Najmniejszy element macierzy i jego położenie.
+     * @return Pierwsze wystąpienie w porządku wierszowym ({0, -1, -1} dla pustej macierzy).
+     */
+    element_skrajny minimum() const;
+
+    /**
+     * @brief Największy element macierzy i jego położenie.
+     * @return Pierwsze wystąpienie w porządku wierszowym ({0, -1, -1} dla pustej macierzy).
+     */
+    element_skrajny maksimum() const;
+
+    /**
+     * @brief Norma ‖A‖₁ - największa suma wartości bezwzględnych w kolumnie.
+     */
+    long long norma_l1() const;
+
+    /**
+     * @brief Norma ‖A‖∞ - największa suma wartości bezwzględnych w wierszu.
+     */
+    long long norma_inf() const;
+
+    /**
+     * @brief Liczba elementów różnych od zera.
+     */
+    long long niezerowe() const;
+
+    /**
+     * @brief 64-bitowy skrót zawartości macierzy.
+     * 
+     * Skrót jest zapamiętywany do następnej zmiany macierzy, dzięki czemu operator==
+     * odrzuca różne macierze bez porównywania elementów. Dopóki istnieją widoki
+     * zapisywalne, skrót jest liczony za każdym razem od nowa.
+     * 
+     * @return Skrót różny od 0; równe macierze mają równe skróty.
+     */
+    std::uint64_t skrot() const;
+
+    // --- Wyznacznik i rząd ---
+
+    /**
+     * @brief Dokładny wyznacznik macierzy dowolnej wielkości.
+     * 
+     * Eliminacja Bareissa, a gdy wynik lub wartości pośrednie nie mieszczą się
+     * w 64 bitach - metoda wielomodularna z odtworzeniem z reszt (wyznacznik_dokladny()).
+     * 
+     * @return Wyznacznik; do_long_long() daje wartość, jeśli w_zakresie_long_long().
+     */
+    duza_liczba wyznacznik() const;
+
+    /**
+     * @brief Rząd macierzy (eliminacja Bareissa bez ułamków).
+     * 
+     * Jeśli wartości pośrednie przekroczą 64 bity - albo ograniczenie Hadamarda z góry
+     * to przesądza - rząd wyznaczany jest modulo dwie duże liczby pierwsze; wynik nie
+     * przekracza prawdziwego rzędu i niemal zawsze mu równy.
+     * 
+     * @param dokladny Jeśli nie nullptr, otrzymuje false, gdy użyto obliczeń modulo p.
+     * @return Rząd macierzy.
+     */
+    int rzad(bool* dokladny = nullptr) const;
+
+    // --- Obserwatorzy ---
+
+    /**
+     * @brief Rejestruje obserwatora zmian macierzy.
+     * @param o Obserwator (nie jest przejmowany na własność; ponowna rejestracja jest ignorowana).
+     */
+    void subskrybuj(obserwator_macierzy* o);
+
+    /**
+     * @brief Wyrejestrowuje obserwatora zmian macierzy.
+     * @param o Obserwator zarejestrowany wcześniej przez subskrybuj().
+     */
+    void anuluj_subskrypcje(obserwator_macierzy* o);
+
+    /**
+     * @brief Informuje obserwatorów o dowolnej zmianie zawartości macierzy.
+     * 
+     * Należy ją wywołać po modyfikacji macierzy przez widoki, których zapisy nie są śledzone;
+     * przywraca wtedy także śledzenie zakresu wartości.
+     */
+    void powiadom_o_zmianie();
+
+    // --- Widoki ---
+
+    /**
+     * @brief Tworzy widok na całą macierz.
+     * 
+     * Wydanie dowolnego widoku zapisywalnego wyłącza śledzenie zakresu wartości
+     * do czasu wymiany bufora (realokacja w alokuj, dowroc) albo wywołania
+     * powiadom_o_zmianie() lub przelicz_zakres() po zniszczeniu wszystkich
+     * wydanych widoków zapisywalnych.
+     * 
+     * @return Widok n×n o kroku wiersza n.
+     */
+    matrix_view widok();
+
+    /**
+     * @brief Tworzy widok tylko do odczytu na całą macierz.
+     * @return Widok n×n o kroku wiersza n.
+     */
+    const_matrix_view widok() const;
+
+    /**
+     * @brief Tworzy widok na prostokątny blok macierzy bez kopiowania danych.
+     * @param x Wiersz lewego górnego rogu bloku.
+     * @param y Kolumna lewego górnego rogu bloku.
+     * @param h Liczba wierszy bloku.
+     * @param w Liczba kolumn bloku.
+     * @return Widok na blok przycięty do granic macierzy (pusty, jeśli (x, y) jest poza zakresem).
+     */
+    matrix_view blok(int x, int y, int h, int w);
+
+    /**
+     * @brief Tworzy widok tylko do odczytu na prostokątny blok macierzy.
+     * @param x Wiersz lewego górnego rogu bloku.
+     * @param y Kolumna lewego górnego rogu bloku.
+     * @param h Liczba wierszy bloku.
+     * @param w Liczba kolumn bloku.
+     * @return Widok na blok przycięty do granic macierzy.
+     */
+    const_matrix_view blok(int x, int y, int h, int w) const;
+
+    /**
+     * @brief Tworzy widok 1×n na wiersz macierzy.
+     * @param y Indeks wiersza (0-based).
+     * @return Widok na wiersz lub widok pusty, jeśli indeks jest poza zakresem.
+     */
+    matrix_view wiersz_widok(int y);
+
+    /**
+     * @brief Tworzy widok tylko do odczytu 1×n na wiersz macierzy.
+     * @param y Indeks wiersza (0-based).
+     * @return Widok na wiersz lub widok pusty, jeśli indeks jest poza zakresem.
+     */
+    const_matrix_view wiersz_widok(int y) const;
+
+    /**
+     * @brief Tworzy widok n×1 na kolumnę macierzy.
+     * @param x Indeks kolumny (0-based).
+     * @return Widok na kolumnę lub widok pusty, jeśli indeks jest poza zakresem.
+     */
+    matrix_view kolumna_widok(int x);
+
+    /**
+     * @brief Tworzy widok tylko do odczytu n×1 na kolumnę macierzy.
+     * @param x Indeks kolumny (0-based).
+     * @return Widok na kolumnę lub widok pusty, jeśli indeks jest poza zakresem.
+     */
+    const_matrix_view kolumna_widok(int x) const;
+
+    /**
+     * @brief Tworzy widok 1×(n-|k|) na diagonalę przesuniętą o k pozycji.
+     * @param k Przesunięcie diagonali (dodatnie - powyżej głównej, ujemne - poniżej).
+     * @return Widok o kroku kolumny n+1 lub widok pusty, jeśli |k| ≥ n.
+     */
+    matrix_view przekatna_widok(int k = 0);
+
+    /**
+     * @brief Tworzy widok tylko do odczytu 1×(n-|k|) na diagonalę przesuniętą o k pozycji.
+     * @param k Przesunięcie diagonali (dodatnie - powyżej głównej, ujemne - poniżej).
+     * @return Widok o kroku kolumny n+1 lub widok pusty, jeśli |k| ≥ n.
+     */
+    const_matrix_view przekatna_widok(int k = 0) const;
+
     // --- Operatory Arytmetyczne ---
     
     /**
@@ -164,14 +460,14 @@ public:
      * @param m Macierz do dodania.
      * @return Nowa macierz będąca sumą dwóch macierzy. Zwraca macierz zerową jeśli rozmiary się nie zgadzają.
      */
-    matrix operator+(const matrix& m);
+    matrix operator+(const matrix& m) const;
     
     /**
      * @brief Mnoży dwie macierze (mnożenie macierzowe).
      * @param m Macierz do pomnożenia.
      * @return Nowa macierz będąca iloczynem dwóch macierzy. Zwraca macierz zerową jeśli rozmiary się nie zgadzają.
      */
-    matrix operator*(const matrix& m);
+    matrix operator*(const matrix& m) const;
     
     /**
      * @brief Dodaje skalar do każdego elementu macierzy.
@@ -194,6 +490,48 @@ public:
      */
     matrix operator-(int a);
 
+    // --- Arytmetyka modularna ---
+
+    /**
+     * @brief Mnoży dwie macierze modulo p (dokładnie, bez przepełnienia int).
+     * @param m Macierz do pomnożenia.
+     * @param p Moduł, p ≥ 2.
+     * @return Nowa macierz z elementami z przedziału [0, p). Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+     */
+    matrix mnoz_mod(const matrix& m, int p) const;
+
+    /**
+     * @brief Podnosi macierz do potęgi k modulo p (szybkie potęgowanie przez podnoszenie do kwadratu).
+     * @param k Wykładnik (k = 0 daje macierz jednostkową).
+     * @param p Moduł, p ≥ 2.
+     * @return Nowa macierz A^k mod p. Zwraca macierz zerową jeśli p < 2.
+     */
+    matrix potega_mod(unsigned long long k, int p) const;
+
+    /**
+     * @brief Dodaje dwie macierze element po elemencie modulo p.
+     * @param m Macierz do dodania.
+     * @param p Moduł, p ≥ 2.
+     * @return Nowa macierz (A + m) mod p. Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+     */
+    matrix dodaj_mod(const matrix& m, int p) const;
+
+    /**
+     * @brief Odejmuje dwie macierze element po elemencie modulo p.
+     * @param m Macierz do odjęcia.
+     * @param p Moduł, p ≥ 2.
+     * @return Nowa macierz (A - m) mod p. Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+     */
+    matrix odejmij_mod(const matrix& m, int p) const;
+
+    /**
+     * @brief Mnoży dwie macierze element po elemencie (iloczyn Hadamarda) modulo p.
+     * @param m Macierz do pomnożenia.
+     * @param p Moduł, p ≥ 2.
+     * @return Nowa macierz (A ∘ m) mod p. Zwraca macierz zerową jeśli rozmiary się nie zgadzają lub p < 2.
+     */
+    matrix hadamard_mod(const matrix& m, int p) const;
+
     // --- Operatory Modyfikujące ---
     
     /**
@@ -241,23 +579,27 @@ public:
     /**
      * @brief Porównuje dwie macierze na równość.
      * @param m Macierz do porównania.
+     * 
+     * Jeśli obie macierze mają zapamiętany skrót (skrot()) i skróty się różnią,
+     * wynik false zwracany jest bez porównywania elementów.
+     * 
      * @return true jeśli macierze są równe (wszystkie elementy identyczne), false w przeciwnym razie.
      */
-    bool operator==(const matrix& m);
+    bool operator==(const matrix& m) const;
     
     /**
      * @brief Porównuje dwie macierze (większe niż).
      * @param m Macierz do porównania.
      * @return true jeśli wszystkie elementy bieżącej macierzy są większe od odpowiadających elementów macierzy m.
      */
-    bool operator>(const matrix& m);
+    bool operator>(const matrix& m) const;
     
     /**
      * @brief Porównuje dwie macierze (mniejsze niż).
      * @param m Macierz do porównania.
      * @return true jeśli wszystkie elementy bieżącej macierzy są mniejsze od odpowiadających elementów macierzy m.
      */
-    bool operator<(const matrix& m);
+    bool operator<(const matrix& m) const;
 
     // --- Funkcje Zaprzyjaźnione ---
     
@@ -291,7 +633,7 @@ public:
      * @param m Macierz do wypisania.
      * @return Referencja do strumienia wyjścia.
      */
-    friend std::ostream& operator<<(std::ostream& o, matrix& m);
+    friend std::ostream& operator<<(std::ostream& o, const matrix& m);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "matrix_alloc.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+const std::size_t DUZA_STRONA = std::size_t(2) << 20; ///< 2 MB - duża strona x86-64 i próg przydziału systemowego
+
+std::atomic<int> tryb(static_cast<int>(strony_duze::przezroczyste));
+
+/**
+ * @brief Zaokrągla rozmiar w górę do wielokrotności dużej strony.
+ */
+std::size_t do_duzych_stron(std::size_t bajty) {
+    return (bajty + DUZA_STRONA - 1) / DUZA_STRONA * DUZA_STRONA;
+}
+
+#if defined(_WIN32)
+
+/**
+ * @brief VirtualAlloc: strony zerowane przez system przy pierwszym dostępie.
+ *
+ * Jawne duże strony wymagają uprawnienia SeLockMemoryPrivilege; bez niego
+ * przydział z MEM_LARGE_PAGES się nie uda i używane są zwykłe strony.
+ */
+void* przydziel_systemowo(std::size_t& bajty) {
+    if (static_cast<strony_duze>(tryb.load()) == strony_duze::jawne) {
+        std::size_t duza = GetLargePageMinimum();
+        if (duza > 0) {
+            std::size_t dl = (bajty + duza - 1) / duza * duza;
+            void* p = VirtualAlloc(nullptr, dl, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (p) {
+                bajty = dl;
+                return p;
+            }
+        }
+    }
+    return VirtualAlloc(nullptr, bajty, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void zwolnij_systemowo(void* p, std::size_t bajty) {
+    (void)bajty;
+    VirtualFree(p, 0, MEM_RELEASE);
+}
+
+#elif defined(__linux__)
+
+/**
+ * @brief mmap anonimowy: strony zerowane przez jądro przy pierwszym dostępie.
+ *
+ * W trybie jawnym najpierw próbowany jest MAP_HUGETLB (wymaga zarezerwowanych stron
+ * w /proc/sys/vm/nr_hugepages). W pozostałych przypadkach odwzorowanie jest
+ * wyrównywane do 2 MB - nadmiar na początku i końcu jest zwracany - i, w trybie
+ * przezroczystym, oznaczane przez madvise(MADV_HUGEPAGE).
+ */
+void* przydziel_systemowo(std::size_t& bajty) {
+    strony_duze t = static_cast<strony_duze>(tryb.load());
+    bajty = do_duzych_stron(bajty);
+#if defined(MAP_HUGETLB)
+    if (t == strony_duze::jawne) {
+        void* p = mmap(nullptr, bajty, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) return p;
+    }
+#endif
+    std::size_t zapas = bajty + DUZA_STRONA;
+    void* surowy = mmap(nullptr, zapas, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (surowy == MAP_FAILED) return nullptr;
+    std::uintptr_t poczatek = reinterpret_cast<std::uintptr_t>(surowy);
+    std::uintptr_t wyrownany = (poczatek + DUZA_STRONA - 1) / DUZA_STRONA * DUZA_STRONA;
+    if (wyrownany > poczatek) munmap(surowy, wyrownany - poczatek);
+    std::size_t ogon = zapas - (wyrownany - poczatek) - bajty;
+    if (ogon > 0) munmap(reinterpret_cast<void*>(wyrownany + bajty), ogon);
+    void* p = reinterpret_cast<void*>(wyrownany);
+#if defined(MADV_HUGEPAGE)
+    if (t != strony_duze::wylaczone) madvise(p, bajty, MADV_HUGEPAGE);
+#endif
+    return p;
+}
+
+void zwolnij_systemowo(void* p, std::size_t bajty) {
+    munmap(p, bajty);
+}
+
+#endif
+
+} // namespace
+
+// --- Tryb dużych stron ---
+
+/**
+ * @brief Ustawia tryb dużych stron dla kolejnych przydziałów.
+ */
+void ustaw_strony_duze(strony_duze t) {
+    tryb.store(static_cast<int>(t));
+}
+
+/**
+ * @brief Zwraca bieżący tryb dużych stron.
+ */
+strony_duze tryb_stron_duzych() {
+    return static_cast<strony_duze>(tryb.load());
+}
+
+// --- Przydział i zwalnianie ---
+
+/**
+ * @brief Zwalnia bufor w sposób odpowiadający jego przydziałowi.
+ */
+void zwalniacz_pamieci::operator()(int* p) const {
+    if (!p) return;
+#if defined(_WIN32) || defined(__linux__)
+    if (bajty > 0) {
+        zwolnij_systemowo(p, bajty);
+        return;
+    }
+#endif
+    std::free(p);
+}
+
+/**
+ * @brief Przydziela wyzerowaną tablicę int bez jawnego zerowania.
+ */
+bufor_int przydziel_zera(std::size_t elementy) {
+    if (elementy == 0) return bufor_int();
+    std::size_t bajty = elementy * sizeof(int);
+#if defined(_WIN32) || defined(__linux__)
+    if (bajty >= DUZA_STRONA) {
+        void* p = przydziel_systemowo(bajty);
+        if (!p) throw std::bad_alloc();
+        zwalniacz_pamieci z;
+        z.bajty = bajty;
+        return bufor_int(static_cast<int*>(p), z);
+    }
+#endif
+    void* p = std::calloc(elementy, sizeof(int));
+    if (!p) throw std::bad_alloc();
+    return bufor_int(static_cast<int*>(p));
+}
@@ -0,0 +1,63 @@
+#ifndef MATRIX_ALLOC_H
+#define MATRIX_ALLOC_H
+
+#include <cstddef>
+#include <memory>
+
+// --- Przydział pamięci na elementy macierzy ---
+// Pamięć zwracana przez przydziel_zera() jest już wyzerowana, ale duże bufory
+// pochodzą bezpośrednio od systemu (mmap / VirtualAlloc): strony fizyczne
+// przydzielane są leniwie, przy pierwszym zapisie, i od razu zerowane przez jądro.
+// Dzięki temu alokacja nie dotyka pamięci, a strona trafia do węzła NUMA wątku,
+// który pierwszy do niej zapisze - wypełnienia macierzy robią to równolegle.
+
+/**
+ * @enum strony_duze
+ * @brief Tryb używania dużych stron (2 MB) dla dużych buforów.
+ */
+enum class strony_duze {
+    wylaczone,      ///< Zwykłe strony 4 KB
+    przezroczyste,  ///< Podpowiedź dla jądra (Linux: madvise(MADV_HUGEPAGE), transparent huge pages)
+    jawne           ///< Jawne duże strony (Linux: MAP_HUGETLB, Windows: MEM_LARGE_PAGES); przy braku - jak przezroczyste
+};
+
+/**
+ * @brief Ustawia tryb dużych stron dla kolejnych przydziałów.
+ * @param tryb Nowy tryb (domyślnie strony_duze::przezroczyste).
+ */
+void ustaw_strony_duze(strony_duze tryb);
+
+/**
+ * @brief Zwraca bieżący tryb dużych stron.
+ */
+strony_duze tryb_stron_duzych();
+
+/**
+ * @struct zwalniacz_pamieci
+ * @brief Deleter dla unique_ptr zwalniający pamięć w sposób, w jaki została przydzielona.
+ */
+struct zwalniacz_pamieci {
+    std::size_t bajty = 0; ///< Długość odwzorowania systemowego (0 - pamięć z calloc)
+
+    /**
+     * @brief Zwalnia bufor (free, munmap lub VirtualFree).
+     * @param p Wskaźnik zwrócony przez przydziel_zera().
+     */
+    void operator()(int* p) const;
+};
+
+using bufor_int = std::unique_ptr<int[], zwalniacz_pamieci>; ///< Bufor elementów macierzy
+
+/**
+ * @brief Przydziela wyzerowaną tablicę int bez jawnego zerowania.
+ *
+ * Bufory od 2 MB wzwyż pobierane są od systemu w całych dużych stronach (wyrównanych
+ * do 2 MB) i - zależnie od tryb_stron_duzych() - oznaczane jako kandydaci do dużych
+ * stron. Mniejsze bufory pochodzą z calloc.
+ *
+ * @param elementy Liczba elementów.
+ * @return Wyzerowany bufor (nullptr dla 0 elementów); przy braku pamięci std::bad_alloc.
+ */
+bufor_int przydziel_zera(std::size_t elementy);
+
+#endif
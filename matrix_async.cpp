@@ -0,0 +1,152 @@
+#include "matrix_async.h"
+#include <fstream>
+
+// --- Pula wątków ---
+
+/**
+ * @brief Tworzy pulę wątków.
+ * @param liczba_watkow Liczba wątków roboczych; 0 oznacza liczbę rdzeni sprzętowych.
+ */
+wykonawca::wykonawca(unsigned liczba_watkow) : koniec(false) {
+    if (liczba_watkow == 0) liczba_watkow = std::thread::hardware_concurrency();
+    if (liczba_watkow == 0) liczba_watkow = 1;
+    for (unsigned i = 0; i < liczba_watkow; ++i) {
+        watki.emplace_back([this] { petla(); });
+    }
+}
+
+/**
+ * @brief Destruktor. Wykonuje pozostałe zadania z kolejki i łączy wątki.
+ */
+wykonawca::~wykonawca() {
+    {
+        std::lock_guard<std::mutex> lock(blokada);
+        koniec = true;
+    }
+    sygnal.notify_all();
+    for (auto& t : watki) t.join();
+}
+
+/**
+ * @brief Pętla wątku roboczego: pobiera i wykonuje zadania aż do zamknięcia puli.
+ *
+ * Przy zamykaniu wątek kończy pracę dopiero po opróżnieniu kolejki, dzięki czemu
+ * kontynuacje zlecone przez ostatnie zadania również zostaną wykonane.
+ */
+void wykonawca::petla() {
+    for (;;) {
+        std::function<void()> zadanie;
+        {
+            std::unique_lock<std::mutex> lock(blokada);
+            sygnal.wait(lock, [this] { return koniec || !kolejka.empty(); });
+            if (kolejka.empty()) return;
+            zadanie = std::move(kolejka.front());
+            kolejka.pop_front();
+        }
+        zadanie();
+    }
+}
+
+/**
+ * @brief Dodaje zadanie do kolejki.
+ * @param zadanie Funkcja do wykonania na jednym z wątków roboczych.
+ */
+void wykonawca::zlec(std::function<void()> zadanie) {
+    {
+        std::lock_guard<std::mutex> lock(blokada);
+        kolejka.push_back(std::move(zadanie));
+    }
+    sygnal.notify_one();
+}
+
+/**
+ * @brief Domyślna pula biblioteki, tworzona przy pierwszym użyciu.
+ * @return Referencja do współdzielonej puli.
+ */
+wykonawca& wykonawca::domyslny() {
+    static wykonawca pula;
+    return pula;
+}
+
+// --- Operacje asynchroniczne ---
+
+/**
+ * @brief Opakowuje gotową macierz w uchwyt, aby mogła być zależnością innych operacji.
+ * @param m Macierz (przenoszona do uchwytu).
+ * @return Uchwyt z ustawionym wynikiem.
+ */
+async_wynik<matrix> async_gotowa(matrix m) {
+    async_wynik<matrix> wynik;
+    wynik.ustaw(std::move(m));
+    return wynik;
+}
+
+/**
+ * @brief Asynchronicznie tworzy macierz n×n wypełnioną losowymi wartościami z zakresu [0, 9].
+ * @param n Rozmiar macierzy.
+ * @return Uchwyt do nowej macierzy.
+ */
+async_wynik<matrix> async_losuj(int n) {
+    return async_utworz(n, [](matrix& m) { m.losuj(); });
+}
+
+/**
+ * @brief Asynchronicznie tworzy macierz n×n i wypełnia ją podaną funkcją.
+ * @param n Rozmiar macierzy.
+ * @param wypelnienie Funkcja wypełniająca, np. [](matrix& m) { m.szachownica(); }.
+ * @return Uchwyt do nowej macierzy.
+ */
+async_wynik<matrix> async_utworz(int n, std::function<void(matrix&)> wypelnienie) {
+    return zaplanuj(wykonawca::domyslny(), [n, wypelnienie]() {
+        matrix m(n);
+        wypelnienie(m);
+        return m;
+    });
+}
+
+/**
+ * @brief Asynchronicznie dodaje dwie macierze (a + b).
+ * @param a Pierwszy składnik.
+ * @param b Drugi składnik.
+ * @return Uchwyt do sumy.
+ */
+async_wynik<matrix> async_dodaj(async_wynik<matrix> a, async_wynik<matrix> b) {
+    return zaplanuj(wykonawca::domyslny(), [](const matrix& x, const matrix& y) { return x + y; }, a, b);
+}
+
+/**
+ * @brief Asynchronicznie mnoży dwie macierze (a · b).
+ * @param a Lewy czynnik.
+ * @param b Prawy czynnik.
+ * @return Uchwyt do iloczynu.
+ */
+async_wynik<matrix> async_mnoz(async_wynik<matrix> a, async_wynik<matrix> b) {
+    return zaplanuj(wykonawca::domyslny(), [](const matrix& x, const matrix& y) { return x * y; }, a, b);
+}
+
+/**
+ * @brief Asynchronicznie transponuje kopię macierzy.
+ * @param a Macierz źródłowa (nie jest modyfikowana).
+ * @return Uchwyt do macierzy transponowanej.
+ */
+async_wynik<matrix> async_dowroc(async_wynik<matrix> a) {
+    return zaplanuj(wykonawca::domyslny(), [](const matrix& x) {
+        matrix t(x);
+        t.dowroc();
+        return t;
+    }, a);
+}
+
+/**
+ * @brief Asynchronicznie zapisuje macierz do pliku tekstowego w formacie operatora <<.
+ * @param a Macierz do zapisania.
+ * @param sciezka Ścieżka pliku (nadpisywany).
+ * @return Uchwyt do wyniku: true jeśli zapis się powiódł.
+ */
+async_wynik<bool> async_zapisz(async_wynik<matrix> a, std::string sciezka) {
+    return zaplanuj(wykonawca::domyslny(), [sciezka](const matrix& x) {
+        std::ofstream plik(sciezka);
+        plik << x;
+        return static_cast<bool>(plik);
+    }, a);
+}
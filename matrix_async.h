@@ -0,0 +1,268 @@
+#ifndef MATRIX_ASYNC_H
+#define MATRIX_ASYNC_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "matrix.h"
+
+/**
+ * @class wykonawca
+ * @brief Pula wątków wykonująca zadania biblioteki w tle.
+ *
+ * Zadania trafiają do wspólnej kolejki FIFO i są pobierane przez stałą liczbę wątków
+ * roboczych. Zadania zlecane przez zaplanuj() nigdy nie czekają na inne zadania -
+ * uruchamiane są dopiero wtedy, gdy wszystkie ich zależności są gotowe - więc pula
+ * nie może się zakleszczyć niezależnie od kształtu grafu zależności.
+ */
+class wykonawca {
+private:
+    std::mutex blokada;                           ///< Chroni kolejkę i flagę zakończenia
+    std::condition_variable sygnal;               ///< Budzi wątki przy nowym zadaniu lub zamknięciu
+    std::deque<std::function<void()>> kolejka;    ///< Zadania oczekujące na wykonanie
+    std::vector<std::thread> watki;               ///< Wątki robocze
+    bool koniec;                                  ///< true po rozpoczęciu zamykania puli
+
+    /**
+     * @brief Pętla wątku roboczego: pobiera i wykonuje zadania aż do zamknięcia puli.
+     */
+    void petla();
+
+public:
+    /**
+     * @brief Tworzy pulę wątków.
+     * @param liczba_watkow Liczba wątków roboczych; 0 oznacza liczbę rdzeni sprzętowych.
+     */
+    explicit wykonawca(unsigned liczba_watkow = 0);
+
+    /**
+     * @brief Destruktor. Wykonuje pozostałe zadania z kolejki i łączy wątki.
+     */
+    ~wykonawca();
+
+    wykonawca(const wykonawca&) = delete;
+    wykonawca& operator=(const wykonawca&) = delete;
+
+    /**
+     * @brief Dodaje zadanie do kolejki.
+     * @param zadanie Funkcja do wykonania na jednym z wątków roboczych.
+     */
+    void zlec(std::function<void()> zadanie);
+
+    /**
+     * @brief Zwraca liczbę wątków roboczych.
+     */
+    unsigned liczba_watkow() const { return static_cast<unsigned>(watki.size()); }
+
+    /**
+     * @brief Domyślna pula biblioteki, tworzona przy pierwszym użyciu.
+     * @return Referencja do współdzielonej puli.
+     */
+    static wykonawca& domyslny();
+};
+
+/**
+ * @class async_wynik
+ * @brief Uchwyt do wyniku operacji asynchronicznej, który można przekazywać jako zależność.
+ *
+ * Opakowuje std::shared_future<T> i dodatkowo pozwala rejestrować kontynuacje
+ * uruchamiane w chwili ustawienia wyniku. Kopie uchwytu współdzielą ten sam stan.
+ *
+ * @tparam T Typ wyniku (np. matrix lub bool).
+ */
+template <typename T>
+class async_wynik {
+private:
+    struct stan {
+        std::mutex blokada;
+        bool gotowy = false;
+        std::vector<std::function<void()>> kontynuacje;
+        std::promise<T> obietnica;
+        std::shared_future<T> przyszlosc;
+        stan() : przyszlosc(obietnica.get_future().share()) {}
+    };
+    std::shared_ptr<stan> s;
+
+    /**
+     * @brief Oznacza stan jako gotowy i uruchamia zarejestrowane kontynuacje.
+     */
+    void zakoncz() const {
+        std::vector<std::function<void()>> do_uruchomienia;
+        {
+            std::lock_guard<std::mutex> lock(s->blokada);
+            s->gotowy = true;
+            do_uruchomienia.swap(s->kontynuacje);
+        }
+        for (auto& f : do_uruchomienia) f();
+    }
+
+public:
+    /**
+     * @brief Tworzy nowy, jeszcze nieustawiony wynik.
+     */
+    async_wynik() : s(std::make_shared<stan>()) {}
+
+    /**
+     * @brief Ustawia wartość wyniku (wywoływane raz, przez zadanie produkujące wynik).
+     * @param wartosc Wartość wyniku.
+     */
+    void ustaw(T wartosc) const {
+        s->obietnica.set_value(std::move(wartosc));
+        zakoncz();
+    }
+
+    /**
+     * @brief Ustawia wyjątek zamiast wartości; get() rzuci go ponownie.
+     * @param e Przechwycony wyjątek.
+     */
+    void ustaw_wyjatek(std::exception_ptr e) const {
+        s->obietnica.set_exception(e);
+        zakoncz();
+    }
+
+    /**
+     * @brief Rejestruje funkcję wywoływaną po ustawieniu wyniku.
+     *
+     * Jeśli wynik jest już gotowy, funkcja jest wywoływana natychmiast w bieżącym wątku.
+     *
+     * @param f Kontynuacja.
+     */
+    void po_zakonczeniu(std::function<void()> f) const {
+        {
+            std::lock_guard<std::mutex> lock(s->blokada);
+            if (!s->gotowy) {
+                s->kontynuacje.push_back(std::move(f));
+                return;
+            }
+        }
+        f();
+    }
+
+    /**
+     * @brief Czeka na wynik i zwraca go.
+     * @return Referencja do wyniku (ważna, dopóki istnieje którykolwiek uchwyt).
+     * @throws Wyjątek zgłoszony przez zadanie lub którąkolwiek z jego zależności.
+     */
+    const T& get() const { return s->przyszlosc.get(); }
+
+    /**
+     * @brief Blokuje bieżący wątek do czasu ustawienia wyniku.
+     */
+    void wait() const { s->przyszlosc.wait(); }
+
+    /**
+     * @brief Sprawdza bez blokowania, czy wynik jest już dostępny.
+     */
+    bool gotowy() const {
+        std::lock_guard<std::mutex> lock(s->blokada);
+        return s->gotowy;
+    }
+
+    /**
+     * @brief Zwraca standardową przyszłość powiązaną z wynikiem.
+     */
+    std::shared_future<T> przyszlosc() const { return s->przyszlosc; }
+};
+
+/**
+ * @brief Planuje wykonanie funkcji na puli po spełnieniu wszystkich zależności.
+ *
+ * Funkcja otrzymuje wartości zależności (const T&) w kolejności argumentów. Zadanie
+ * trafia do kolejki puli dopiero, gdy ostatnia zależność zostanie ustawiona, więc
+ * niezależne gałęzie grafu wykonują się równolegle, a żaden wątek nie czeka bezczynnie.
+ * Wyjątek z zależności lub z samej funkcji jest przekazywany do wyniku.
+ *
+ * @param pula Pula wykonująca zadanie.
+ * @param f Funkcja obliczająca wynik.
+ * @param zaleznosci Wyniki, od których zależy zadanie.
+ * @return Uchwyt do wyniku funkcji.
+ */
+template <typename F, typename... Z>
+auto zaplanuj(wykonawca& pula, F f, async_wynik<Z>... zaleznosci)
+    -> async_wynik<std::decay_t<std::invoke_result_t<F, const Z&...>>> {
+    using R = std::decay_t<std::invoke_result_t<F, const Z&...>>;
+    async_wynik<R> wynik;
+    auto pozostalo = std::make_shared<std::atomic<int>>(static_cast<int>(sizeof...(Z)) + 1);
+    auto uruchom = [&pula, f, wynik, pozostalo, zaleznosci...]() {
+        if (pozostalo->fetch_sub(1) != 1) return;
+        pula.zlec([f, wynik, zaleznosci...]() {
+            try {
+                wynik.ustaw(f(zaleznosci.get()...));
+            } catch (...) {
+                wynik.ustaw_wyjatek(std::current_exception());
+            }
+        });
+    };
+    int rozwin[] = {0, (zaleznosci.po_zakonczeniu(uruchom), 0)...};
+    (void)rozwin;
+    uruchom();
+    return wynik;
+}
+
+// --- Operacje asynchroniczne na domyślnej puli ---
+// Każda funkcja zwraca natychmiast; wynik można przekazać jako zależność kolejnej operacji.
+
+/**
+ * @brief Opakowuje gotową macierz w uchwyt, aby mogła być zależnością innych operacji.
+ * @param m Macierz (przenoszona do uchwytu).
+ * @return Uchwyt z ustawionym wynikiem.
+ */
+async_wynik<matrix> async_gotowa(matrix m);
+
+/**
+ * @brief Asynchronicznie tworzy macierz n×n wypełnioną losowymi wartościami z zakresu [0, 9].
+ * @param n Rozmiar macierzy.
+ * @return Uchwyt do nowej macierzy.
+ */
+async_wynik<matrix> async_losuj(int n);
+
+/**
+ * @brief Asynchronicznie tworzy macierz n×n i wypełnia ją podaną funkcją.
+ * @param n Rozmiar macierzy.
+ * @param wypelnienie Funkcja wypełniająca, np. [](matrix& m) { m.szachownica(); }.
+ * @return Uchwyt do nowej macierzy.
+ */
+async_wynik<matrix> async_utworz(int n, std::function<void(matrix&)> wypelnienie);
+
+/**
+ * @brief Asynchronicznie dodaje dwie macierze (a + b).
+ * @param a Pierwszy składnik.
+ * @param b Drugi składnik.
+ * @return Uchwyt do sumy.
+ */
+async_wynik<matrix> async_dodaj(async_wynik<matrix> a, async_wynik<matrix> b);
+
+/**
+ * @brief Asynchronicznie mnoży dwie macierze (a · b).
+ * @param a Lewy czynnik.
+ * @param b Prawy czynnik.
+ * @return Uchwyt do iloczynu.
+ */
+async_wynik<matrix> async_mnoz(async_wynik<matrix> a, async_wynik<matrix> b);
+
+/**
+ * @brief Asynchronicznie transponuje kopię macierzy.
+ * @param a Macierz źródłowa (nie jest modyfikowana).
+ * @return Uchwyt do macierzy transponowanej.
+ */
+async_wynik<matrix> async_dowroc(async_wynik<matrix> a);
+
+/**
+ * @brief Asynchronicznie zapisuje macierz do pliku tekstowego w formacie operatora <<.
+ * @param a Macierz do zapisania.
+ * @param sciezka Ścieżka pliku (nadpisywany).
+ * @return Uchwyt do wyniku: true jeśli zapis się powiódł.
+ */
+async_wynik<bool> async_zapisz(async_wynik<matrix> a, std::string sciezka);
+
+#endif
@@ -0,0 +1,152 @@
+#include "matrix_bigint.h"
+#include "matrix_mod.h"
+#include <climits>
+
+// --- Operacje na modułach ---
+
+/**
+ * @brief Mnoży moduł przez małą liczbę i dodaje drugą: |x| = |x| · mnoznik + skladnik.
+ */
+void duza_liczba::pomnoz_dodaj(uint32_t mnoznik, uint32_t skladnik) {
+    uint64_t przeniesienie = skladnik;
+    for (uint32_t& c : cyfry) {
+        uint64_t t = static_cast<uint64_t>(c) * mnoznik + przeniesienie;
+        c = static_cast<uint32_t>(t);
+        przeniesienie = t >> 32;
+    }
+    if (przeniesienie != 0) cyfry.push_back(static_cast<uint32_t>(przeniesienie));
+    while (!cyfry.empty() && cyfry.back() == 0) cyfry.pop_back();
+}
+
+/**
+ * @brief Porównuje moduły: -1, 0 lub 1.
+ */
+int duza_liczba::porownaj_moduly(const std::vector<uint32_t>& x, const std::vector<uint32_t>& y) {
+    if (x.size() != y.size()) return x.size() < y.size() ? -1 : 1;
+    for (std::size_t i = x.size(); i-- > 0;) {
+        if (x[i] != y[i]) return x[i] < y[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Różnica modułów x - y (wymaga x ≥ y).
+ */
+std::vector<uint32_t> duza_liczba::odejmij_moduly(const std::vector<uint32_t>& x, const std::vector<uint32_t>& y) {
+    std::vector<uint32_t> r(x.size());
+    int64_t pozyczka = 0;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        int64_t t = static_cast<int64_t>(x[i]) - (i < y.size() ? y[i] : 0) - pozyczka;
+        pozyczka = t < 0;
+        r[i] = static_cast<uint32_t>(t + (pozyczka << 32));
+    }
+    while (!r.empty() && r.back() == 0) r.pop_back();
+    return r;
+}
+
+// --- Konstrukcja ---
+
+/**
+ * @brief Tworzy liczbę o wartości x.
+ * @param x Wartość początkowa.
+ */
+duza_liczba::duza_liczba(long long x) : ujemna_(x < 0) {
+    unsigned long long m = x < 0 ? 0ULL - static_cast<unsigned long long>(x) : static_cast<unsigned long long>(x);
+    while (m != 0) {
+        cyfry.push_back(static_cast<uint32_t>(m));
+        m >>= 32;
+    }
+}
+
+/**
+ * @brief Odtwarza liczbę z reszt (algorytm Garnera).
+ *
+ * Cyfry mieszanej podstawy v_i spełniają x = v_0 + p_0 · (v_1 + p_1 · (v_2 + ...));
+ * v_i wyznaczana jest modulo p_i z reszty r_i, wcześniejszych cyfr i odwrotności
+ * p_0 · ... · p_(i-1) mod p_i. Koszt O(t²) dla t modułów. Na końcu wynik z [0, M)
+ * przenoszony jest do przedziału symetrycznego.
+ */
+duza_liczba duza_liczba::z_reszt(const std::vector<uint32_t>& reszty, const std::vector<uint32_t>& moduly) {
+    duza_liczba wynik;
+    if (reszty.size() != moduly.size()) return wynik;
+    std::size_t t = moduly.size();
+    std::vector<uint32_t> v(t);
+    for (std::size_t i = 0; i < t; ++i) {
+        uint32_t p = moduly[i];
+        barrett br(p);
+        uint64_t y = 0;       // v_0 + p_0 · (v_1 + ...) mod p, Hornerem od v_(i-1)
+        uint64_t iloczyn = 1; // p_0 · ... · p_(i-1) mod p
+        for (std::size_t j = i; j-- > 0;) y = br.redukuj(y * (moduly[j] % p) + v[j] % p);
+        for (std::size_t j = 0; j < i; ++j) iloczyn = br.redukuj(iloczyn * (moduly[j] % p));
+        uint64_t roznica = (reszty[i] % p + static_cast<uint64_t>(p) - y) % p;
+        v[i] = br.redukuj(roznica * br.potega(static_cast<uint32_t>(iloczyn), p - 2));
+    }
+
+    duza_liczba m(1);
+    for (std::size_t i = t; i-- > 0;) {
+        wynik.pomnoz_dodaj(moduly[i], v[i]);
+        m.pomnoz_dodaj(moduly[i], 0);
+    }
+    duza_liczba podwojony = wynik;
+    podwojony.pomnoz_dodaj(2, 0);
+    if (porownaj_moduly(podwojony.cyfry, m.cyfry) > 0) {
+        wynik.cyfry = odejmij_moduly(m.cyfry, wynik.cyfry);
+        wynik.ujemna_ = true;
+    }
+    return wynik;
+}
+
+// --- Konwersje ---
+
+/**
+ * @brief Czy liczba mieści się w long long.
+ */
+bool duza_liczba::w_zakresie_long_long() const {
+    if (cyfry.size() > 2) return false;
+    unsigned long long m = 0;
+    for (std::size_t i = cyfry.size(); i-- > 0;) m = (m << 32) | cyfry[i];
+    return m <= (ujemna_ ? 1ULL << 63 : static_cast<unsigned long long>(LLONG_MAX));
+}
+
+/**
+ * @brief Wartość jako long long (nasycana do LLONG_MIN / LLONG_MAX).
+ */
+long long duza_liczba::do_long_long() const {
+    if (!w_zakresie_long_long()) return ujemna_ ? LLONG_MIN : LLONG_MAX;
+    unsigned long long m = 0;
+    for (std::size_t i = cyfry.size(); i-- > 0;) m = (m << 32) | cyfry[i];
+    return ujemna_ ? static_cast<long long>(0ULL - m) : static_cast<long long>(m);
+}
+
+/**
+ * @brief Zapis dziesiętny - kolejne dzielenia modułu przez 10⁹.
+ */
+std::string duza_liczba::napis() const {
+    if (cyfry.empty()) return "0";
+    std::vector<uint32_t> m = cyfry;
+    std::vector<uint32_t> grupy; // po 9 cyfr dziesiętnych, od najmniej znaczącej
+    while (!m.empty()) {
+        uint64_t reszta = 0;
+        for (std::size_t i = m.size(); i-- > 0;) {
+            uint64_t t = (reszta << 32) | m[i];
+            m[i] = static_cast<uint32_t>(t / 1000000000u);
+            reszta = t % 1000000000u;
+        }
+        while (!m.empty() && m.back() == 0) m.pop_back();
+        grupy.push_back(static_cast<uint32_t>(reszta));
+    }
+    std::string s = ujemna_ ? "-" : "";
+    s += std::to_string(grupy.back());
+    for (std::size_t i = grupy.size() - 1; i-- > 0;) {
+        std::string g = std::to_string(grupy[i]);
+        s += std::string(9 - g.size(), '0') + g;
+    }
+    return s;
+}
+
+/**
+ * @brief Wypisuje liczbę dziesiętnie do strumienia.
+ */
+std::ostream& operator<<(std::ostream& o, const duza_liczba& x) {
+    return o << x.napis();
+}
@@ -0,0 +1,96 @@
+#ifndef MATRIX_BIGINT_H
+#define MATRIX_BIGINT_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// --- Liczby całkowite dowolnej długości ---
+
+/**
+ * @class duza_liczba
+ * @brief Liczba całkowita dowolnej długości - wynik dokładnego wyznacznika.
+ *
+ * Moduł przechowywany jest jako cyfry o podstawie 2³² (od najmniej znaczącej, bez
+ * zer wiodących), znak osobno. Klasa udostępnia tylko to, czego potrzebuje wyznacznik:
+ * konstrukcję z long long, odtworzenie z reszt (chińskie twierdzenie o resztach),
+ * porównanie, konwersję do long long i zapis dziesiętny.
+ */
+class duza_liczba {
+private:
+    std::vector<uint32_t> cyfry; ///< Moduł, cyfry o podstawie 2³² od najmniej znaczącej
+    bool ujemna_;                ///< true dla liczb mniejszych od zera
+
+    void pomnoz_dodaj(uint32_t mnoznik, uint32_t skladnik);
+    static int porownaj_moduly(const std::vector<uint32_t>& x, const std::vector<uint32_t>& y);
+    static std::vector<uint32_t> odejmij_moduly(const std::vector<uint32_t>& x, const std::vector<uint32_t>& y);
+
+public:
+    /**
+     * @brief Tworzy liczbę o wartości x.
+     * @param x Wartość początkowa.
+     */
+    duza_liczba(long long x = 0);
+
+    /**
+     * @brief Odtwarza liczbę z reszt modulo różne liczby pierwsze (algorytm Garnera).
+     *
+     * Wynik leży w przedziale symetrycznym (-M/2, M/2], gdzie M to iloczyn modułów.
+     *
+     * @param reszty Reszty r_i z przedziału [0, p_i).
+     * @param moduly Różne liczby pierwsze p_i < 2³¹.
+     * @return Jedyna liczba x z przedziału symetrycznego, dla której x ≡ r_i (mod p_i); 0 przy niezgodnych długościach.
+     */
+    static duza_liczba z_reszt(const std::vector<uint32_t>& reszty, const std::vector<uint32_t>& moduly);
+
+    /**
+     * @brief Czy liczba jest zerem.
+     */
+    bool zero() const { return cyfry.empty(); }
+
+    /**
+     * @brief Czy liczba jest ujemna.
+     */
+    bool ujemna() const { return ujemna_; }
+
+    /**
+     * @brief Czy liczba mieści się w long long.
+     */
+    bool w_zakresie_long_long() const;
+
+    /**
+     * @brief Wartość jako long long.
+     * @return Wartość liczby; LLONG_MIN lub LLONG_MAX (według znaku), jeśli się nie mieści.
+     */
+    long long do_long_long() const;
+
+    /**
+     * @brief Zapis dziesiętny (ze znakiem minus dla liczb ujemnych).
+     */
+    std::string napis() const;
+
+    /**
+     * @brief Porównanie dwóch liczb.
+     * @param x Druga liczba.
+     * @return true, jeśli liczby są równe.
+     */
+    bool operator==(const duza_liczba& x) const { return ujemna_ == x.ujemna_ && cyfry == x.cyfry; }
+
+    /**
+     * @brief Porównanie dwóch liczb.
+     * @param x Druga liczba.
+     * @return true, jeśli liczby są różne.
+     */
+    bool operator!=(const duza_liczba& x) const { return !(*this == x); }
+};
+
+/**
+ * @brief Wypisuje liczbę dziesiętnie do strumienia.
+ * @param o Strumień wyjścia.
+ * @param x Liczba do wypisania.
+ * @return Referencja do strumienia wyjścia.
+ */
+std::ostream& operator<<(std::ostream& o, const duza_liczba& x);
+
+#endif
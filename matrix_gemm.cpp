@@ -0,0 +1,366 @@
+#include "matrix_gemm.h"
+#include "matrix_parallel.h"
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include "matrix_simd.h"
+
+// --- Funkcje pomocnicze ---
+
+/**
+ * @brief Odejmuje dwa widoki element po elemencie (dst = a - b).
+ */
+static void odejmij(matrix_view dst, const_matrix_view a, const_matrix_view b) {
+    for (int i = 0; i < dst.liczba_wierszy(); ++i)
+        for (int j = 0; j < dst.liczba_kolumn(); ++j)
+            dst(i, j) = a(i, j) - b(i, j);
+}
+
+/**
+ * @struct bufor
+ * @brief Tymczasowa, ciągła macierz kwadratowa h×h wraz z widokiem na nią.
+ */
+struct bufor {
+    std::vector<int> dane;
+    matrix_view v;
+    explicit bufor(int h)
+        : dane(static_cast<std::size_t>(h) * h), v(dane.data(), h, h, h) {}
+};
+
+// --- Mnożenie blokowe ---
+
+/**
+ * @brief Mnożenie blokowe (kafelkowane) i wielowątkowe (dst = a · b).
+ *
+ * Każdy wątek otrzymuje rozłączny zakres pasów wierszy wyniku, więc zapisy do dst
+ * nie wymagają synchronizacji. W obrębie pasa kafelki liczone są przez mnoz_dodaj().
+ *
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ * @param blok Bok kafelka (≥ 1).
+ * @param watki Liczba wątków (≤ 1 - sekwencyjnie).
+ */
+void mnoz_blokowo(matrix_view dst, const_matrix_view a, const_matrix_view b, int blok, int watki) {
+    int h = a.liczba_wierszy();
+    int k = a.liczba_kolumn();
+    int w = b.liczba_kolumn();
+    if (b.liczba_wierszy() != k || dst.liczba_wierszy() != h || dst.liczba_kolumn() != w) return;
+    if (blok < 1) blok = 1;
+
+    int pasy = (h + blok - 1) / blok;
+    rownolegle(0, pasy, watki, [=](int od, int do_) {
+        for (int ib = od; ib < do_; ++ib) {
+            int i0 = ib * blok;
+            int ih = std::min(blok, h - i0);
+            wypelnij(dst.blok(i0, 0, ih, w), 0);
+            for (int k0 = 0; k0 < k; k0 += blok) {
+                int kh = std::min(blok, k - k0);
+                for (int j0 = 0; j0 < w; j0 += blok) {
+                    int jw = std::min(blok, w - j0);
+                    mnoz_dodaj(dst.blok(i0, j0, ih, jw), a.blok(i0, k0, ih, kh), b.blok(k0, j0, kh, jw));
+                }
+            }
+        }
+    });
+}
+
+// --- Algorytm Strassena ---
+
+/**
+ * @brief Krok rekurencji Strassena dla macierzy n×n.
+ *
+ * Używa wariantu z trzema buforami na poziom: suma/różnica bloków a, suma/różnica
+ * bloków b oraz bieżący iloczyn Mi, który jest od razu rozprowadzany do ćwiartek dst.
+ */
+static void strassen_krok(matrix_view c, const_matrix_view a, const_matrix_view b, int prog, int blok, int watki) {
+    int n = a.liczba_wierszy();
+    if (n <= prog || n % 2 != 0) {
+        mnoz_blokowo(c, a, b, blok, watki);
+        return;
+    }
+    int h = n / 2;
+    const_matrix_view a11 = a.blok(0, 0, h, h), a12 = a.blok(0, h, h, h);
+    const_matrix_view a21 = a.blok(h, 0, h, h), a22 = a.blok(h, h, h, h);
+    const_matrix_view b11 = b.blok(0, 0, h, h), b12 = b.blok(0, h, h, h);
+    const_matrix_view b21 = b.blok(h, 0, h, h), b22 = b.blok(h, h, h, h);
+    matrix_view c11 = c.blok(0, 0, h, h), c12 = c.blok(0, h, h, h);
+    matrix_view c21 = c.blok(h, 0, h, h), c22 = c.blok(h, h, h, h);
+
+    bufor ta(h), tb(h), m(h);
+
+    // M1 = (A11 + A22)(B11 + B22) -> C11, C22
+    dodaj(ta.v, a11, a22);
+    dodaj(tb.v, b11, b22);
+    strassen_krok(m.v, ta.v, tb.v, prog, blok, watki);
+    kopiuj(c11, m.v);
+    kopiuj(c22, m.v);
+
+    // M2 = (A21 + A22) B11 -> C21, -C22
+    dodaj(ta.v, a21, a22);
+    strassen_krok(m.v, ta.v, b11, prog, blok, watki);
+    kopiuj(c21, m.v);
+    odejmij(c22, c22, m.v);
+
+    // M3 = A11 (B12 - B22) -> C12, C22
+    odejmij(tb.v, b12, b22);
+    strassen_krok(m.v, a11, tb.v, prog, blok, watki);
+    kopiuj(c12, m.v);
+    dodaj(c22, c22, m.v);
+
+    // M4 = A22 (B21 - B11) -> C11, C21
+    odejmij(tb.v, b21, b11);
+    strassen_krok(m.v, a22, tb.v, prog, blok, watki);
+    dodaj(c11, c11, m.v);
+    dodaj(c21, c21, m.v);
+
+    // M5 = (A11 + A12) B22 -> -C11, C12
+    dodaj(ta.v, a11, a12);
+    strassen_krok(m.v, ta.v, b22, prog, blok, watki);
+    odejmij(c11, c11, m.v);
+    dodaj(c12, c12, m.v);
+
+    // M6 = (A21 - A11)(B11 + B12) -> C22
+    odejmij(ta.v, a21, a11);
+    dodaj(tb.v, b11, b12);
+    strassen_krok(m.v, ta.v, tb.v, prog, blok, watki);
+    dodaj(c22, c22, m.v);
+
+    // M7 = (A12 - A22)(B21 + B22) -> C11
+    odejmij(ta.v, a12, a22);
+    dodaj(tb.v, b21, b22);
+    strassen_krok(m.v, ta.v, tb.v, prog, blok, watki);
+    dodaj(c11, c11, m.v);
+}
+
+/**
+ * @brief Mnożenie algorytmem Strassena dla macierzy kwadratowych (dst = a · b).
+ * @param dst Widok wynikowy n×n (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik n×n.
+ * @param b Prawy czynnik n×n.
+ * @param prog Bok, poniżej którego rekurencja przechodzi na mnożenie blokowe.
+ * @param blok Bok kafelka dla liści rekurencji.
+ * @param watki Liczba wątków dla liści rekurencji.
+ */
+void mnoz_strassen(matrix_view dst, const_matrix_view a, const_matrix_view b, int prog, int blok, int watki) {
+    int n = a.liczba_wierszy();
+    if (a.liczba_kolumn() != n || b.liczba_wierszy() != n || b.liczba_kolumn() != n ||
+        dst.liczba_wierszy() != n || dst.liczba_kolumn() != n) {
+        mnoz_blokowo(dst, a, b, blok, watki);
+        return;
+    }
+    if (prog < 1) prog = 1;
+    if (n <= prog) {
+        mnoz_blokowo(dst, a, b, blok, watki);
+        return;
+    }
+
+    // Najmniejszy rozmiar m ≥ n, który po L podziałach na pół daje liść ≤ prog
+    int poziomy = 0;
+    int lisc = n;
+    while (lisc > prog) {
+        lisc = (lisc + 1) / 2;
+        ++poziomy;
+    }
+    int m = lisc << poziomy;
+    if (m == n) {
+        strassen_krok(dst, a, b, prog, blok, watki);
+        return;
+    }
+
+    bufor pa(m), pb(m), pc(m);
+    kopiuj(pa.v.blok(0, 0, n, n), a);
+    kopiuj(pb.v.blok(0, 0, n, n), b);
+    strassen_krok(pc.v, pa.v, pb.v, prog, blok, watki);
+    kopiuj(dst, pc.v.blok(0, 0, n, n));
+}
+
+// --- Wąskie jądra SIMD ---
+
+namespace {
+
+const int WYROWNANIE_K = 32; ///< Długość wektorów po uzupełnieniu zerami (pełne rejestry AVX2)
+
+/**
+ * @brief Iloczyn skalarny wektorów int16; kp jest wielokrotnością WYROWNANIE_K.
+ *
+ * Wersja bazowa: pmaddwd SSE2, jeśli kompilator go dopuszcza, inaczej skalarnie.
+ */
+int iloczyn16(const int16_t* x, const int16_t* y, int kp) {
+#if defined(__SSE2__)
+    __m128i acc = _mm_setzero_si128();
+    for (int k = 0; k < kp; k += 8) {
+        __m128i vx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + k));
+        __m128i vy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + k));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(vx, vy));
+    }
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+    return _mm_cvtsi128_si32(acc);
+#else
+    int s = 0;
+    for (int k = 0; k < kp; ++k) s += static_cast<int>(x[k]) * y[k];
+    return s;
+#endif
+}
+
+#if MATRIX_SIMD_X86
+/**
+ * @brief Suma poziomych kanałów 32-bitowych rejestru SSE.
+ */
+CEL_SSSE3 inline int suma_kanalow(__m128i s) {
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+/**
+ * @brief Suma poziomych kanałów 32-bitowych rejestru AVX2.
+ */
+CEL_AVX2 inline int suma_kanalow(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+/**
+ * @brief Iloczyn skalarny wektorów int16 (vpmaddwd, 16 elementów na krok).
+ */
+CEL_AVX2 int iloczyn16_avx2(const int16_t* x, const int16_t* y, int kp) {
+    __m256i acc = _mm256_setzero_si256();
+    for (int k = 0; k < kp; k += 16) {
+        __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + k));
+        __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + k));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(vx, vy));
+    }
+    return suma_kanalow(acc);
+}
+
+/**
+ * @brief Iloczyn skalarny uint8 × int8 (pmaddubsw, następnie pmaddwd z jedynkami).
+ */
+CEL_SSSE3 int iloczyn8_ssse3(const uint8_t* u, const int8_t* s, int kp) {
+    const __m128i jedynki = _mm_set1_epi16(1);
+    __m128i acc = _mm_setzero_si128();
+    for (int k = 0; k < kp; k += 16) {
+        __m128i vu = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + k));
+        __m128i vs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + k));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_maddubs_epi16(vu, vs), jedynki));
+    }
+    return suma_kanalow(acc);
+}
+
+/**
+ * @brief Jak iloczyn8_ssse3(), 32 elementy na krok.
+ */
+CEL_AVX2 int iloczyn8_avx2(const uint8_t* u, const int8_t* s, int kp) {
+    const __m256i jedynki = _mm256_set1_epi16(1);
+    __m256i acc = _mm256_setzero_si256();
+    for (int k = 0; k < kp; k += 32) {
+        __m256i vu = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(u + k));
+        __m256i vs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + k));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_maddubs_epi16(vu, vs), jedynki));
+    }
+    return suma_kanalow(acc);
+}
+#endif
+
+/**
+ * @brief Pakuje wiersze a (h×k) i kolumny b (k×w) do ciągłych wektorów długości kp
+ * i liczy dst(i, j) = iloczyn(wiersz_i, kolumna_j).
+ *
+ * @tparam TA Typ spakowanego elementu a.
+ * @tparam TB Typ spakowanego elementu b.
+ * @tparam F Funkcja iloczynu skalarnego (const TA*, const TB*, int kp) -> int.
+ */
+template <typename TA, typename TB, typename F>
+void mnoz_spakowane(matrix_view dst, const_matrix_view a, const_matrix_view b, int watki, F iloczyn) {
+    int h = a.liczba_wierszy();
+    int k = a.liczba_kolumn();
+    int w = b.liczba_kolumn();
+    int kp = (k + WYROWNANIE_K - 1) / WYROWNANIE_K * WYROWNANIE_K;
+
+    std::vector<TA> pa(static_cast<std::size_t>(h) * kp, 0);
+    std::vector<TB> pb(static_cast<std::size_t>(w) * kp, 0);
+    rownolegle(0, h, watki, [&](int od, int do_) {
+        for (int i = od; i < do_; ++i)
+            for (int q = 0; q < k; ++q) pa[static_cast<std::size_t>(i) * kp + q] = static_cast<TA>(a(i, q));
+    });
+    rownolegle(0, w, watki, [&](int od, int do_) {
+        for (int q = 0; q < k; ++q)
+            for (int j = od; j < do_; ++j) pb[static_cast<std::size_t>(j) * kp + q] = static_cast<TB>(b(q, j));
+    });
+
+    // Pas 64 kolumn b pozostaje w pamięci podręcznej, gdy przechodzą przez niego kolejne wiersze a
+    const int PAS = 64;
+    rownolegle(0, h, watki, [&](int od, int do_) {
+        for (int j0 = 0; j0 < w; j0 += PAS) {
+            int j1 = std::min(w, j0 + PAS);
+            for (int i = od; i < do_; ++i) {
+                const TA* wiersz = &pa[static_cast<std::size_t>(i) * kp];
+                for (int j = j0; j < j1; ++j) dst(i, j) = iloczyn(wiersz, &pb[static_cast<std::size_t>(j) * kp], kp);
+            }
+        }
+    });
+}
+
+} // namespace
+
+/**
+ * @brief Mnożenie w arytmetyce 8- lub 16-bitowej, jeśli zakresy wartości to dopuszczają.
+ *
+ * Warunki wyboru jądra (M_a, M_b - największe moduły elementów):
+ * - zawsze: k · M_a · M_b ≤ INT_MAX (żadna suma częściowa nie przepełni int),
+ * - 8 bit: jeden operand w [0, 255], drugi w [-128, 127] oraz 2 · M_a · M_b ≤ 32767
+ *   (pmaddubsw nasyca sumy par do int16),
+ * - 16 bit: oba operandy w [-32768, 32767].
+ *
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ * @param a_min Dolne ograniczenie elementów a.
+ * @param a_max Górne ograniczenie elementów a.
+ * @param b_min Dolne ograniczenie elementów b.
+ * @param b_max Górne ograniczenie elementów b.
+ * @param watki Liczba wątków.
+ * @return true jeśli mnożenie zostało wykonane; false jeśli zakresy (lub wymiary) na to nie pozwalają.
+ */
+bool mnoz_waskie(matrix_view dst, const_matrix_view a, const_matrix_view b,
+                 int a_min, int a_max, int b_min, int b_max, int watki) {
+    int h = a.liczba_wierszy();
+    int k = a.liczba_kolumn();
+    int w = b.liczba_kolumn();
+    if (b.liczba_wierszy() != k || dst.liczba_wierszy() != h || dst.liczba_kolumn() != w) return false;
+    if (h == 0 || w == 0) return true;
+
+    long long ma = std::max(std::llabs(a_min), std::llabs(a_max));
+    long long mb = std::max(std::llabs(b_min), std::llabs(b_max));
+    if (ma > 32768 || mb > 32768) return false;
+    if (static_cast<long long>(k) * ma * mb > INT_MAX) return false;
+
+    int (*i16)(const int16_t*, const int16_t*, int) = iloczyn16;
+#if MATRIX_SIMD_X86
+    if (procesor_ma_avx2()) i16 = iloczyn16_avx2;
+    if (procesor_ma_ssse3() && 2 * ma * mb <= 32767) {
+        int (*i8)(const uint8_t*, const int8_t*, int) = procesor_ma_avx2() ? iloczyn8_avx2 : iloczyn8_ssse3;
+        if (a_min >= 0 && a_max <= 255 && b_min >= -128 && b_max <= 127) {
+            mnoz_spakowane<uint8_t, int8_t>(dst, a, b, watki, i8);
+            return true;
+        }
+        if (b_min >= 0 && b_max <= 255 && a_min >= -128 && a_max <= 127) {
+            mnoz_spakowane<int8_t, uint8_t>(dst, a, b, watki,
+                [i8](const int8_t* x, const uint8_t* y, int kp) { return i8(y, x, kp); });
+            return true;
+        }
+    }
+#endif
+    if (a_min >= -32768 && a_max <= 32767 && b_min >= -32768 && b_max <= 32767) {
+        mnoz_spakowane<int16_t, int16_t>(dst, a, b, watki, i16);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,67 @@
+#ifndef MATRIX_GEMM_H
+#define MATRIX_GEMM_H
+
+#include "matrix_view.h"
+
+// --- Algorytmy mnożenia macierzy ---
+// Uzupełniają podstawowe jądro mnoz() z matrix_view.h o warianty blokowe i
+// wielowątkowe. Wybór wariantu dla danego rozmiaru należy do strojenia
+// (matrix_tuning.h); funkcje poniżej przyjmują parametry jawnie.
+
+/**
+ * @brief Mnożenie blokowe (kafelkowane) i wielowątkowe (dst = a · b).
+ *
+ * Pętle i, k, j są dzielone na kafelki o boku `blok`, tak aby fragmenty a, b i dst
+ * mieściły się w pamięci podręcznej. Wiersze wyniku dzielone są między `watki` wątków.
+ *
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ * @param blok Bok kafelka (≥ 1).
+ * @param watki Liczba wątków (≤ 1 - sekwencyjnie).
+ */
+void mnoz_blokowo(matrix_view dst, const_matrix_view a, const_matrix_view b, int blok, int watki);
+
+/**
+ * @brief Mnożenie algorytmem Strassena dla macierzy kwadratowych (dst = a · b).
+ *
+ * Rekurencja zatrzymuje się, gdy bok podmacierzy nie przekracza `prog`; liście liczone
+ * są przez mnoz_blokowo(). Rozmiary, które nie dzielą się wystarczająco wiele razy
+ * przez 2, są uzupełniane zerami do najbliższego pasującego rozmiaru. Wynik jest
+ * dokładny (arytmetyka całkowitoliczbowa). Dla widoków prostokątnych funkcja
+ * wykonuje mnoz_blokowo().
+ *
+ * @param dst Widok wynikowy n×n (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik n×n.
+ * @param b Prawy czynnik n×n.
+ * @param prog Bok, poniżej którego rekurencja przechodzi na mnożenie blokowe.
+ * @param blok Bok kafelka dla liści rekurencji.
+ * @param watki Liczba wątków dla liści rekurencji.
+ */
+void mnoz_strassen(matrix_view dst, const_matrix_view a, const_matrix_view b, int prog, int blok, int watki);
+
+/**
+ * @brief Mnożenie w arytmetyce 8- lub 16-bitowej, jeśli zakresy wartości to dopuszczają.
+ *
+ * Operandy są pakowane do tablic int8/uint8 lub int16 (b w układzie kolumnowym),
+ * a elementy wyniku liczone jako iloczyny skalarne instrukcjami pmaddubsw (8 bit,
+ * wymaga SSSE3/AVX2) lub pmaddwd (16 bit, SSE2/AVX2); wariant SSSE3/AVX2 wybierany
+ * jest w czasie wykonania według możliwości procesora. Jądro jest wybierane tylko
+ * wtedy, gdy ograniczenia gwarantują, że ani sumy par w rejestrach 16-bitowych,
+ * ani żadna suma częściowa nie przekroczą zakresu - wynik jest wtedy identyczny
+ * z wynikiem mnożenia 32-bitowego.
+ *
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ * @param a_min Dolne ograniczenie elementów a.
+ * @param a_max Górne ograniczenie elementów a.
+ * @param b_min Dolne ograniczenie elementów b.
+ * @param b_max Górne ograniczenie elementów b.
+ * @param watki Liczba wątków.
+ * @return true jeśli mnożenie zostało wykonane; false jeśli zakresy (lub wymiary) na to nie pozwalają.
+ */
+bool mnoz_waskie(matrix_view dst, const_matrix_view a, const_matrix_view b,
+                 int a_min, int a_max, int b_min, int b_max, int watki);
+
+#endif
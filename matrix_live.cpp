@@ -0,0 +1,245 @@
+#include "matrix_live.h"
+#include <cstddef>
+#include <utility>
+
+// --- Konstrukcja ---
+
+/**
+ * @brief Tworzy iloczyn A · B i zaczyna śledzić zmiany obu czynników.
+ * @param a Lewy czynnik.
+ * @param b Prawy czynnik.
+ * @param prog_wsadu Liczba oczekujących poprawek, powyżej której są łączone w jedno mnożenie.
+ */
+iloczyn_na_zywo::iloczyn_na_zywo(matrix& a, matrix& b, int prog_wsadu)
+    : a(&a), b(&b), nieaktualny(true), prog_wsadu(prog_wsadu) {
+    a.subskrybuj(this);
+    b.subskrybuj(this);
+}
+
+/**
+ * @brief Destruktor. Wyrejestrowuje obiekt z czynników, które nadal istnieją.
+ */
+iloczyn_na_zywo::~iloczyn_na_zywo() {
+    if (a) a->anuluj_subskrypcje(this);
+    if (b && b != a) b->anuluj_subskrypcje(this);
+}
+
+// --- Powiadomienia ---
+
+/**
+ * @brief Czy zmianę czynnika można wyrazić poprawką.
+ *
+ * Poprawki wymagają dwóch różnych czynników tego samego rozmiaru - wzory odczytują
+ * drugi czynnik z rozmiarem pierwszego, więc sprawdzenie musi poprzedzić dostęp
+ * do widoków. W pozostałych przypadkach iloczyn jest przeliczany od nowa.
+ */
+bool iloczyn_na_zywo::poprawki_mozliwe() const {
+    return a != b && static_cast<const matrix&>(*a).widok().liczba_wierszy() ==
+                     static_cast<const matrix&>(*b).widok().liczba_wierszy();
+}
+
+/**
+ * @brief Zmiana bez szczegółów - iloczyn zostanie przeliczony od nowa.
+ */
+void iloczyn_na_zywo::po_zmianie(const matrix& m) {
+    (void)m;
+    nieaktualny = true;
+    oczekujace.clear();
+}
+
+/**
+ * @brief Zmiana jednego elementu: poprawka O(n).
+ *
+ * A[x][y] += d zmienia tylko wiersz x wyniku o d · B[y][·];
+ * B[x][y] += d zmienia tylko kolumnę y wyniku o d · A[·][x].
+ */
+void iloczyn_na_zywo::po_wstawieniu(const matrix& m, int x, int y, int stara) {
+    if (nieaktualny || !a || !b) return;
+    if (!poprawki_mozliwe()) { po_zmianie(m); return; }
+    int d = m.pokaz(x, y) - stara;
+    if (d == 0) return;
+
+    const_matrix_view wa = static_cast<const matrix&>(*a).widok();
+    const_matrix_view wb = static_cast<const matrix&>(*b).widok();
+    int n = wa.liczba_wierszy();
+    poprawka p;
+    if (&m == a) {
+        p.wiersz_u = x;
+        p.kolumna_v = -1;
+        p.v.resize(n);
+        for (int j = 0; j < n; ++j) p.v[j] = d * wb(y, j);
+    } else {
+        p.wiersz_u = -1;
+        p.u.resize(n);
+        for (int i = 0; i < n; ++i) p.u[i] = d * wa(i, x);
+        p.kolumna_v = y;
+    }
+    dodaj_poprawke(std::move(p));
+}
+
+/**
+ * @brief Zastąpienie wiersza: poprawka O(n²).
+ *
+ * Różnica r wiersza y w A daje C[y][·] += r · B; w B daje C += A[·][y] · rᵀ.
+ */
+void iloczyn_na_zywo::po_wierszu(const matrix& m, int y, const int* stary) {
+    if (nieaktualny || !a || !b) return;
+    if (!poprawki_mozliwe()) { po_zmianie(m); return; }
+
+    const_matrix_view wa = static_cast<const matrix&>(*a).widok();
+    const_matrix_view wb = static_cast<const matrix&>(*b).widok();
+    int n = wa.liczba_wierszy();
+    std::vector<int> r(n);
+    bool zmiana = false;
+    for (int j = 0; j < n; ++j) {
+        r[j] = m.pokaz(y, j) - stary[j];
+        if (r[j] != 0) zmiana = true;
+    }
+    if (!zmiana) return;
+
+    poprawka p;
+    if (&m == a) {
+        p.wiersz_u = y;
+        p.kolumna_v = -1;
+        p.v.assign(n, 0);
+        for (int k = 0; k < n; ++k) {
+            if (r[k] == 0) continue;
+            for (int j = 0; j < n; ++j) p.v[j] += r[k] * wb(k, j);
+        }
+    } else {
+        p.wiersz_u = -1;
+        p.u.resize(n);
+        for (int i = 0; i < n; ++i) p.u[i] = wa(i, y);
+        p.kolumna_v = -1;
+        p.v = std::move(r);
+    }
+    dodaj_poprawke(std::move(p));
+}
+
+/**
+ * @brief Zastąpienie kolumny: poprawka O(n²).
+ *
+ * Różnica r kolumny x w A daje C += r · B[x][·]; w B daje C[·][x] += A · r.
+ */
+void iloczyn_na_zywo::po_kolumnie(const matrix& m, int x, const int* stara) {
+    if (nieaktualny || !a || !b) return;
+    if (!poprawki_mozliwe()) { po_zmianie(m); return; }
+
+    const_matrix_view wa = static_cast<const matrix&>(*a).widok();
+    const_matrix_view wb = static_cast<const matrix&>(*b).widok();
+    int n = wa.liczba_wierszy();
+    std::vector<int> r(n);
+    bool zmiana = false;
+    for (int i = 0; i < n; ++i) {
+        r[i] = m.pokaz(i, x) - stara[i];
+        if (r[i] != 0) zmiana = true;
+    }
+    if (!zmiana) return;
+
+    poprawka p;
+    if (&m == a) {
+        p.wiersz_u = -1;
+        p.u = std::move(r);
+        p.kolumna_v = -1;
+        p.v.resize(n);
+        for (int j = 0; j < n; ++j) p.v[j] = wb(x, j);
+    } else {
+        p.wiersz_u = -1;
+        p.u.assign(n, 0);
+        for (int i = 0; i < n; ++i)
+            for (int k = 0; k < n; ++k)
+                if (r[k] != 0) p.u[i] += wa(i, k) * r[k];
+        p.kolumna_v = x;
+    }
+    dodaj_poprawke(std::move(p));
+}
+
+/**
+ * @brief Czynnik jest niszczony - obiekt przestaje się do niego odwoływać.
+ *
+ * Wynik pozostaje dostępny w stanie z chwili zniszczenia czynnika.
+ */
+void iloczyn_na_zywo::po_zniszczeniu(const matrix& m) {
+    uaktualnij();
+    if (&m == a) a = nullptr;
+    if (&m == b) b = nullptr;
+}
+
+// --- Stosowanie poprawek ---
+
+/**
+ * @brief Dodaje poprawkę do kolejki lub przełącza na pełne przeliczenie.
+ *
+ * Gdy liczba poprawek osiąga n, ich łączny koszt (n² na poprawkę) dorównuje
+ * pełnemu mnożeniu, więc kolejka jest porzucana na rzecz przeliczenia. Zgodność
+ * rozmiarów czynników sprawdza wcześniej poprawki_mozliwe().
+ */
+void iloczyn_na_zywo::dodaj_poprawke(poprawka p) {
+    int n = static_cast<const matrix&>(*a).widok().liczba_wierszy();
+    if (static_cast<int>(oczekujace.size()) + 1 >= n) {
+        po_zmianie(*a);
+        return;
+    }
+    oczekujace.push_back(std::move(p));
+}
+
+/**
+ * @brief Stosuje wszystkie oczekujące poprawki (lub przelicza iloczyn od nowa).
+ *
+ * Po poprawkach zakres wartości c wyznaczany jest jednym przebiegiem O(n²),
+ * więc wynik nadal korzysta z wąskich jąder mnożenia i zapamiętanego skrótu.
+ */
+void iloczyn_na_zywo::uaktualnij() const {
+    if (nieaktualny) {
+        if (a && b) c = static_cast<const matrix&>(*a) * static_cast<const matrix&>(*b);
+        nieaktualny = false;
+        oczekujace.clear();
+        return;
+    }
+    if (oczekujace.empty()) return;
+
+    {
+        // Widok zapisywalny wyłącza śledzenie zakresu c; żyje tylko do końca bloku
+        matrix_view wc = c.widok();
+        int n = wc.liczba_wierszy();
+        int k = static_cast<int>(oczekujace.size());
+
+        if (k <= prog_wsadu) {
+            for (const poprawka& p : oczekujace) {
+                if (p.wiersz_u >= 0) {
+                    for (int j = 0; j < n; ++j) wc(p.wiersz_u, j) += p.v[j];
+                } else if (p.kolumna_v >= 0) {
+                    for (int i = 0; i < n; ++i) wc(i, p.kolumna_v) += p.u[i];
+                } else {
+                    for (int i = 0; i < n; ++i) {
+                        if (p.u[i] == 0) continue;
+                        for (int j = 0; j < n; ++j) wc(i, j) += p.u[i] * p.v[j];
+                    }
+                }
+            }
+        } else {
+            // C += U · V, gdzie kolumna t macierzy U i wiersz t macierzy V to poprawka t
+            std::vector<int> du(static_cast<std::size_t>(n) * k, 0), dv(static_cast<std::size_t>(k) * n, 0);
+            matrix_view u(du.data(), n, k, k), v(dv.data(), k, n, n);
+            for (int t = 0; t < k; ++t) {
+                const poprawka& p = oczekujace[t];
+                if (p.wiersz_u >= 0) u(p.wiersz_u, t) = 1;
+                else for (int i = 0; i < n; ++i) u(i, t) = p.u[i];
+                if (p.kolumna_v >= 0) v(t, p.kolumna_v) = 1;
+                else for (int j = 0; j < n; ++j) v(t, j) = p.v[j];
+            }
+            mnoz_dodaj(wc, u, v);
+        }
+    }
+    c.przelicz_zakres();                // zakres i skrót c znów śledzone
+    oczekujace.clear();
+}
+
+/**
+ * @brief Zwraca aktualny iloczyn, stosując przedtem oczekujące poprawki.
+ * @return Referencja do wyniku (ważna do następnej zmiany czynników lub odczytu).
+ */
+const matrix& iloczyn_na_zywo::wynik() const {
+    uaktualnij();
+    return c;
+}
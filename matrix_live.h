@@ -0,0 +1,98 @@
+#ifndef MATRIX_LIVE_H
+#define MATRIX_LIVE_H
+
+#include <vector>
+#include "matrix.h"
+
+/**
+ * @class iloczyn_na_zywo
+ * @brief Iloczyn C = A · B utrzymywany na bieżąco przy edycji A i B.
+ *
+ * Obiekt subskrybuje powiadomienia obu czynników i zamienia każdą zmianę na poprawkę
+ * rzędu 1 (C += u · vᵀ) obliczoną względem aktualnego stanu drugiego czynnika:
+ * - wstaw() w A lub B: poprawka O(n),
+ * - wiersz() / kolumna() w A lub B: poprawka O(n²).
+ *
+ * Poprawki są kolejkowane i stosowane dopiero przy odczycie wyniku. Do `prog_wsadu`
+ * poprawek stosowanych jest pojedynczo (z pominięciem zer w wektorach jednostkowych);
+ * powyżej progu łączone są w macierze U (n×k) i V (k×n) i dodawane jednym mnożeniem
+ * niskiego rzędu. Gdy poprawek jest co najmniej n, a także po zmianach bez szczegółów
+ * (losuj, operatory, alokuj, zapisy przez widoki zgłoszone przez powiadom_o_zmianie())
+ * iloczyn liczony jest od nowa.
+ *
+ * Jeśli A i B to ten sam obiekt, każda zmiana powoduje pełne przeliczenie.
+ */
+class iloczyn_na_zywo : private obserwator_macierzy {
+private:
+    /**
+     * @struct poprawka
+     * @brief Poprawka rzędu 1: C += u · vᵀ.
+     *
+     * Wektor jednostkowy zapisywany jest jako indeks (wiersz_u / kolumna_v ≥ 0)
+     * zamiast pełnego wektora, co pozwala zastosować poprawkę w czasie O(n).
+     */
+    struct poprawka {
+        int wiersz_u;         ///< u = e_wiersz_u, jeśli ≥ 0
+        std::vector<int> u;   ///< Pełny wektor u (gdy wiersz_u < 0)
+        int kolumna_v;        ///< v = e_kolumna_v, jeśli ≥ 0
+        std::vector<int> v;   ///< Pełny wektor v (gdy kolumna_v < 0)
+    };
+
+    matrix* a;                          ///< Lewy czynnik (nullptr po jego zniszczeniu)
+    matrix* b;                          ///< Prawy czynnik (nullptr po jego zniszczeniu)
+    mutable matrix c;                   ///< Ostatnio obliczony iloczyn
+    mutable std::vector<poprawka> oczekujace; ///< Poprawki jeszcze niezastosowane do c
+    mutable bool nieaktualny;           ///< true - c wymaga pełnego przeliczenia
+    int prog_wsadu;                     ///< Liczba poprawek, powyżej której stosowane są wsadowo
+
+    void po_zmianie(const matrix& m) override;
+    void po_wstawieniu(const matrix& m, int x, int y, int stara) override;
+    void po_wierszu(const matrix& m, int y, const int* stary) override;
+    void po_kolumnie(const matrix& m, int x, const int* stara) override;
+    void po_zniszczeniu(const matrix& m) override;
+
+    /**
+     * @brief Czy zmianę czynnika można wyrazić poprawką (różne czynniki tego samego rozmiaru).
+     */
+    bool poprawki_mozliwe() const;
+
+    /**
+     * @brief Dodaje poprawkę do kolejki lub przełącza na pełne przeliczenie.
+     */
+    void dodaj_poprawke(poprawka p);
+
+    /**
+     * @brief Stosuje wszystkie oczekujące poprawki (lub przelicza iloczyn od nowa).
+     */
+    void uaktualnij() const;
+
+public:
+    /**
+     * @brief Tworzy iloczyn A · B i zaczyna śledzić zmiany obu czynników.
+     * @param a Lewy czynnik (musi istnieć co najmniej do zniszczenia tego obiektu lub sam o tym powiadomi).
+     * @param b Prawy czynnik.
+     * @param prog_wsadu Liczba oczekujących poprawek, powyżej której są łączone w jedno mnożenie.
+     */
+    iloczyn_na_zywo(matrix& a, matrix& b, int prog_wsadu = 8);
+
+    /**
+     * @brief Destruktor. Wyrejestrowuje obiekt z czynników, które nadal istnieją.
+     */
+    ~iloczyn_na_zywo();
+
+    iloczyn_na_zywo(const iloczyn_na_zywo&) = delete;
+    iloczyn_na_zywo& operator=(const iloczyn_na_zywo&) = delete;
+
+    /**
+     * @brief Zwraca aktualny iloczyn, stosując przedtem oczekujące poprawki.
+     * @return Referencja do wyniku (ważna do następnej zmiany czynników lub odczytu).
+     */
+    const matrix& wynik() const;
+
+    /**
+     * @brief Zwraca liczbę poprawek oczekujących na zastosowanie.
+     */
+    int liczba_oczekujacych() const { return static_cast<int>(oczekujace.size()); }
+};
+
+#endif
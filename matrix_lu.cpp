@@ -0,0 +1,478 @@
+#include "matrix_lu.h"
+#include "matrix_mod.h"
+#include "matrix_parallel.h"
+#include "matrix_tuning.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+namespace {
+
+const long long ELEMENTY_NA_WATEK = 1LL << 14; ///< Minimalna liczba aktualizowanych elementów na wątek w kroku eliminacji
+const double BITY_BAREISSA = 2 * 63;           ///< Ograniczenie Hadamarda, powyżej którego Bareiss jest pomijany
+
+/**
+ * @brief Liczba wątków dla kroku eliminacji aktualizującego zadaną liczbę elementów.
+ */
+int watki_kroku(long long elementy, int watki) {
+    long long w = elementy / ELEMENTY_NA_WATEK;
+    return static_cast<int>(std::max(1LL, std::min<long long>(w, watki)));
+}
+
+/**
+ * @brief Jeden krok Bareissa: wynik = (a · b - c · d) / dzielnik (dzielenie dokładne).
+ *
+ * Najpierw próbowana jest arytmetyka 64-bitowa; dopiero przy przepełnieniu iloczyny
+ * liczone są w 128 bitach (|a · b| < 2¹²⁶, więc różnica zawsze się mieści).
+ *
+ * @return false, jeśli wynik nie mieści się w long long.
+ */
+inline bool krok_bareissa(long long a, long long b, long long c, long long d, long long dzielnik, long long& wynik) {
+    long long ab, cd, r;
+    if (!__builtin_mul_overflow(a, b, &ab) && !__builtin_mul_overflow(c, d, &cd) &&
+        !__builtin_sub_overflow(ab, cd, &r) && r != LLONG_MIN) {
+        wynik = r / dzielnik;
+        return true;
+    }
+    __int128 s = static_cast<__int128>(a) * b - static_cast<__int128>(c) * d;
+    s /= dzielnik;
+    if (s < LLONG_MIN || s > LLONG_MAX) return false;
+    wynik = static_cast<long long>(s);
+    return true;
+}
+
+/**
+ * @brief Eliminacja Bareissa na kopii h×w, sprowadzająca ją do postaci schodkowej.
+ *
+ * @param m Elementy wiersz po wierszu (nadpisywane).
+ * @param h Liczba wierszy.
+ * @param w Liczba kolumn.
+ * @param watki Maksymalna liczba wątków.
+ * @param stop_bez_osi true - przerwij przy pierwszej kolumnie bez elementu głównego (wyznacznik = 0).
+ * @param znak Znak permutacji wierszy.
+ * @return Liczba elementów głównych (rząd lub indeks kolumny bez osi); -1 przy przepełnieniu.
+ */
+int bareiss(std::vector<long long>& m, int h, int w, int watki, bool stop_bez_osi, int& znak) {
+    long long poprzedni = 1;
+    int r = 0;
+    znak = 1;
+    std::atomic<bool> przepelnienie(false);
+    for (int c = 0; c < w && r < h; ++c) {
+        int p = r;
+        while (p < h && m[static_cast<std::size_t>(p) * w + c] == 0) ++p;
+        if (p == h) {
+            if (stop_bez_osi) return r;
+            continue;
+        }
+        if (p != r) {
+            std::swap_ranges(&m[static_cast<std::size_t>(r) * w], &m[static_cast<std::size_t>(r) * w] + w,
+                             &m[static_cast<std::size_t>(p) * w]);
+            znak = -znak;
+        }
+        const long long* os = &m[static_cast<std::size_t>(r) * w];
+        long long akk = os[c];
+        int wt = watki_kroku(static_cast<long long>(h - r - 1) * (w - c), watki);
+        rownolegle(r + 1, h, wt, [&](int od, int do_) {
+            for (int i = od; i < do_; ++i) {
+                long long* wi = &m[static_cast<std::size_t>(i) * w];
+                long long aik = wi[c];
+                for (int j = c + 1; j < w; ++j) {
+                    if (!krok_bareissa(akk, wi[j], aik, os[j], poprzedni, wi[j])) {
+                        przepelnienie = true;
+                        return;
+                    }
+                }
+                wi[c] = 0;
+            }
+        });
+        if (przepelnienie) return -1;
+        poprzedni = akk;
+        ++r;
+    }
+    return r;
+}
+
+/**
+ * @brief Kopiuje widok do ciągłej tablicy long long.
+ */
+std::vector<long long> kopia64(const_matrix_view a) {
+    int h = a.liczba_wierszy();
+    int w = a.liczba_kolumn();
+    std::vector<long long> m(static_cast<std::size_t>(h) * w);
+    for (int i = 0; i < h; ++i)
+        for (int j = 0; j < w; ++j) m[static_cast<std::size_t>(i) * w + j] = a(i, j);
+    return m;
+}
+
+/**
+ * @brief Odejmuje iloczyn od widoku: c -= a · b (kafelki o boku blok, pasy wierszy równolegle).
+ *
+ * Odpowiednik mnoz_blokowo() dla double; c nie może pokrywać się z a ani b.
+ */
+void odejmij_iloczyn(basic_view<double> c, basic_view<const double> a, basic_view<const double> b,
+                     int blok, int watki) {
+    int h = c.liczba_wierszy();
+    int w = c.liczba_kolumn();
+    int k = a.liczba_kolumn();
+    int pasy = (h + blok - 1) / blok;
+    rownolegle(0, pasy, watki, [=](int od, int do_) {
+        for (int ib = od; ib < do_; ++ib) {
+            int i0 = ib * blok;
+            int i1 = std::min(h, i0 + blok);
+            for (int k0 = 0; k0 < k; k0 += blok) {
+                int k1 = std::min(k, k0 + blok);
+                for (int j0 = 0; j0 < w; j0 += blok) {
+                    int jw = std::min(blok, w - j0);
+                    for (int i = i0; i < i1; ++i) {
+                        double* ci = &c(i, j0);
+                        for (int q = k0; q < k1; ++q) {
+                            double aiq = a(i, q);
+                            if (aiq == 0.0) continue;
+                            const double* bq = &b(q, j0);
+                            for (int j = 0; j < jw; ++j) ci[j] -= aiq * bq[j];
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Kopiuje widok do ciągłej tablicy reszt z przedziału [0, p).
+ */
+std::vector<uint32_t> reszty(const_matrix_view a, uint32_t p) {
+    int h = a.liczba_wierszy();
+    int w = a.liczba_kolumn();
+    std::vector<uint32_t> m(static_cast<std::size_t>(h) * w);
+    for (int i = 0; i < h; ++i)
+        for (int j = 0; j < w; ++j) {
+            long long x = a(i, j) % static_cast<long long>(p);
+            m[static_cast<std::size_t>(i) * w + j] = static_cast<uint32_t>(x < 0 ? x + p : x);
+        }
+    return m;
+}
+
+/**
+ * @brief Eliminacja Gaussa modulo p na tablicy reszt h×w.
+ *
+ * Wiersz osiowy jest normalizowany (mnożony przez odwrotność elementu głównego
+ * z małego twierdzenia Fermata), po czym wiersze poniżej aktualizowane są równolegle.
+ *
+ * @param m Reszty wiersz po wierszu (nadpisywane).
+ * @param h Liczba wierszy.
+ * @param w Liczba kolumn.
+ * @param p Moduł pierwszy.
+ * @param watki Maksymalna liczba wątków.
+ * @param stop_bez_osi true - przerwij przy pierwszej kolumnie bez elementu głównego.
+ * @param wyznacznik Iloczyn elementów głównych ze znakiem permutacji (mod p); 0 po przerwaniu.
+ * @return Liczba elementów głównych.
+ */
+int schodkowa_mod(std::vector<uint32_t>& m, int h, int w, uint32_t p, int watki, bool stop_bez_osi,
+                  uint32_t& wyznacznik) {
+    barrett br(p);
+    uint64_t iloczyn = 1;
+    bool ujemny = false;
+    int r = 0;
+    for (int c = 0; c < w && r < h; ++c) {
+        int q = r;
+        while (q < h && m[static_cast<std::size_t>(q) * w + c] == 0) ++q;
+        if (q == h) {
+            if (stop_bez_osi) {
+                wyznacznik = 0;
+                return r;
+            }
+            continue;
+        }
+        uint32_t* os = &m[static_cast<std::size_t>(r) * w];
+        if (q != r) {
+            std::swap_ranges(os, os + w, &m[static_cast<std::size_t>(q) * w]);
+            ujemny = !ujemny;
+        }
+        iloczyn = br.redukuj(iloczyn * os[c]);
+        uint64_t odw = br.potega(os[c], p - 2);
+        for (int j = c; j < w; ++j) os[j] = br.redukuj(os[j] * odw);
+
+        int wt = watki_kroku(static_cast<long long>(h - r - 1) * (w - c), watki);
+        rownolegle(r + 1, h, wt, [&](int od, int do_) {
+            for (int i = od; i < do_; ++i) {
+                uint32_t* wi = &m[static_cast<std::size_t>(i) * w];
+                uint64_t f = wi[c];
+                if (f == 0) continue;
+                uint64_t minus_f = static_cast<uint64_t>(p) - f;
+                for (int j = c; j < w; ++j) wi[j] = br.redukuj(wi[j] + minus_f * os[j]);
+            }
+        });
+        ++r;
+    }
+    wyznacznik = static_cast<uint32_t>(ujemny && iloczyn != 0 ? p - iloczyn : iloczyn);
+    return r;
+}
+
+/**
+ * @brief Wyznacznik kwadratowego widoku modulo p.
+ */
+uint32_t wyznacznik_reszty(const_matrix_view a, uint32_t p, int watki) {
+    int n = a.liczba_wierszy();
+    std::vector<uint32_t> m = reszty(a, p);
+    uint32_t wynik;
+    schodkowa_mod(m, n, n, p, watki, true, wynik);
+    return wynik;
+}
+
+/**
+ * @brief Test pierwszości Millera-Rabina, deterministyczny dla x < 3 215 031 751 (świadkowie 2, 3, 5, 7).
+ */
+bool pierwsza(uint32_t x) {
+    if (x < 2) return false;
+    for (uint32_t d : {2u, 3u, 5u, 7u}) {
+        if (x % d == 0) return x == d;
+    }
+    barrett br(x);
+    uint32_t d = x - 1;
+    int s = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        ++s;
+    }
+    for (uint32_t swiadek : {2u, 3u, 5u, 7u}) {
+        uint64_t y = br.potega(swiadek, d);
+        if (y == 1 || y == x - 1) continue;
+        bool zlozona = true;
+        for (int k = 1; k < s && zlozona; ++k) {
+            y = br.redukuj(y * y);
+            if (y == x - 1) zlozona = false;
+        }
+        if (zlozona) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+// --- Eliminacja Bareissa ---
+
+/**
+ * @brief Wyznacznik metodą Bareissa.
+ *
+ * Ostatni element główny eliminacji Bareissa jest równy wyznacznikowi (z dokładnością
+ * do znaku permutacji). Kolumna bez elementu głównego kończy obliczenia z wynikiem 0.
+ * Gdy ograniczenie Hadamarda przekracza 2¹²⁶, przepełnienie jest niemal pewne
+ * i eliminacja nie jest podejmowana.
+ */
+bool wyznacznik_bareiss(const_matrix_view a, long long& wynik, int watki) {
+    int n = a.liczba_wierszy();
+    wynik = 0;
+    if (a.liczba_kolumn() != n) return true;
+    if (n == 0) {
+        wynik = 1;
+        return true;
+    }
+    if (bity_hadamarda(a) > BITY_BAREISSA) return false;
+    std::vector<long long> m = kopia64(a);
+    int znak;
+    int r = bareiss(m, n, n, watki, true, znak);
+    if (r < 0) return false;
+    if (r == n) wynik = znak * m[static_cast<std::size_t>(n) * n - 1];
+    return true;
+}
+
+/**
+ * @brief Rząd metodą Bareissa - liczba elementów głównych postaci schodkowej.
+ *
+ * Podobnie jak wyznacznik_bareiss(), przy ograniczeniu Hadamarda powyżej 2¹²⁶
+ * od razu zgłasza przepełnienie.
+ */
+bool rzad_bareiss(const_matrix_view a, int& wynik, int watki) {
+    if (bity_hadamarda(a) > BITY_BAREISSA) {
+        wynik = -1;
+        return false;
+    }
+    std::vector<long long> m = kopia64(a);
+    int znak;
+    wynik = bareiss(m, a.liczba_wierszy(), a.liczba_kolumn(), watki, false, znak);
+    return wynik >= 0;
+}
+
+/**
+ * @brief Rząd nad ciałem Z_p.
+ */
+int rzad_mod(const_matrix_view a, int p) {
+    if (p < 2) return -1;
+    std::vector<uint32_t> m = reszty(a, static_cast<uint32_t>(p));
+    uint32_t wyznacznik;
+    return schodkowa_mod(m, a.liczba_wierszy(), a.liczba_kolumn(), static_cast<uint32_t>(p),
+                         liczba_watkow_sprzetowych(), false, wyznacznik);
+}
+
+/**
+ * @brief Wyznacznik modulo p.
+ */
+int wyznacznik_mod(const_matrix_view a, int p) {
+    if (p < 2 || a.liczba_wierszy() != a.liczba_kolumn()) return -1;
+    return static_cast<int>(wyznacznik_reszty(a, static_cast<uint32_t>(p), liczba_watkow_sprzetowych()));
+}
+
+/**
+ * @brief Logarytm dwójkowy ograniczenia Hadamarda.
+ *
+ * Sumy kwadratów liczone są w long double (do 2⁶² na składnik); drobny błąd
+ * zaokrąglenia pokrywa zapas, z jakim korzysta wyznacznik_dokladny().
+ */
+double bity_hadamarda(const_matrix_view a) {
+    double bity = 0;
+    for (int i = 0; i < a.liczba_wierszy(); ++i) {
+        long double s = 0;
+        for (int j = 0; j < a.liczba_kolumn(); ++j) s += static_cast<long double>(a(i, j)) * a(i, j);
+        if (s > 0) bity += 0.5 * static_cast<double>(std::log2(s));
+    }
+    return bity;
+}
+
+/**
+ * @brief Dokładny wyznacznik: Bareiss, a gdy 64 bity nie wystarczą - metoda wielomodularna.
+ *
+ * Liczby pierwsze wybierane są od 2³¹ - 1 w dół, aż suma
+ * ich logarytmów przekroczy ograniczenie o 2 bity (|det| < M/2 z zapasem na
+ * zaokrąglenia). Wątki dzielą się najpierw liczbami pierwszymi, a reszta wątków
+ * trafia do eliminacji dla każdej z nich.
+ */
+duza_liczba wyznacznik_dokladny(const_matrix_view a, int watki) {
+    int n = a.liczba_wierszy();
+    if (a.liczba_kolumn() != n) return duza_liczba(0);
+    if (n == 0) return duza_liczba(1);
+
+    long long wynik;
+    if (wyznacznik_bareiss(a, wynik, watki)) return duza_liczba(wynik);
+    double bity = bity_hadamarda(a);
+
+    std::vector<uint32_t> moduly;
+    double pokryte = 0;
+    for (uint32_t p = 2147483647u; pokryte < bity + 2; p -= 2) {
+        if (!pierwsza(p)) continue;
+        moduly.push_back(p);
+        pokryte += std::log2(static_cast<double>(p));
+    }
+    int t = static_cast<int>(moduly.size());
+    std::vector<uint32_t> r(moduly.size());
+    int wewnetrzne = std::max(1, watki / t);
+    rownolegle(0, t, watki, [&](int od, int do_) {
+        for (int k = od; k < do_; ++k) r[k] = wyznacznik_reszty(a, moduly[k], wewnetrzne);
+    });
+    return duza_liczba::z_reszt(r, moduly);
+}
+
+// --- Rozkład LU ---
+
+/**
+ * @brief Rozkłada macierz a (blokowo, prawostronnie, z częściowym wyborem elementu głównego).
+ *
+ * Dla każdego panelu kolumn [k0, k0 + kb):
+ * 1. panel (wiersze k0..n-1) rozkładany jest kolumna po kolumnie; zamiany wierszy
+ *    obejmują całą szerokość macierzy,
+ * 2. U12 = L11⁻¹ · A12 (podstawianie w przód, kolumny A12 dzielone między wątki),
+ * 3. A22 -= L21 · U12 (mnożenie blokowe i wielowątkowe).
+ */
+rozklad_lu::rozklad_lu(const matrix& a, int blok, int watki)
+    : n(a.widok().liczba_wierszy()), znak(1), osobliwa_(false) {
+    const_matrix_view wa = a.widok();
+    parametry_mnozenia pm = strojenie::parametry(n);
+    if (blok <= 0) blok = pm.blok;
+    if (watki <= 0) watki = pm.watki;
+
+    lu.resize(static_cast<std::size_t>(n) * n);
+    perm.resize(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    basic_view<double> A(lu.data(), n, n, n);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j) A(i, j) = wa(i, j);
+
+    for (int k0 = 0; k0 < n; k0 += blok) {
+        int k1 = std::min(n, k0 + blok);
+
+        // 1. Panel
+        for (int j = k0; j < k1; ++j) {
+            int p = j;
+            double najwiekszy = std::fabs(A(j, j));
+            for (int i = j + 1; i < n; ++i) {
+                if (std::fabs(A(i, j)) > najwiekszy) {
+                    najwiekszy = std::fabs(A(i, j));
+                    p = i;
+                }
+            }
+            if (najwiekszy == 0.0) {
+                osobliwa_ = true;
+                continue;
+            }
+            if (p != j) {
+                std::swap_ranges(&A(j, 0), &A(j, 0) + n, &A(p, 0));
+                std::swap(perm[j], perm[p]);
+                znak = -znak;
+            }
+            double odw = 1.0 / A(j, j);
+            for (int i = j + 1; i < n; ++i) {
+                double l = (A(i, j) *= odw);
+                if (l == 0.0) continue;
+                for (int c = j + 1; c < k1; ++c) A(i, c) -= l * A(j, c);
+            }
+        }
+        if (k1 >= n) break;
+
+        // 2. U12 = L11⁻¹ · A12
+        rownolegle(k1, n, watki, [&](int od, int do_) {
+            for (int j = k0; j < k1; ++j)
+                for (int i = j + 1; i < k1; ++i) {
+                    double l = A(i, j);
+                    if (l == 0.0) continue;
+                    for (int c = od; c < do_; ++c) A(i, c) -= l * A(j, c);
+                }
+        });
+
+        // 3. A22 -= L21 · U12
+        odejmij_iloczyn(A.blok(k1, k1, n - k1, n - k1), A.blok(k1, k0, n - k1, k1 - k0),
+                        A.blok(k0, k1, k1 - k0, n - k1), blok, watki);
+    }
+}
+
+/**
+ * @brief Wyznacznik: znak permutacji razy iloczyn diagonali U.
+ */
+double rozklad_lu::wyznacznik() const {
+    if (osobliwa_) return 0.0;
+    double d = znak;
+    for (int i = 0; i < n; ++i) d *= lu[static_cast<std::size_t>(i) * n + i];
+    return d;
+}
+
+/**
+ * @brief Rozwiązuje A · x = b: L · y = P · b (w przód), następnie U · x = y (wstecz).
+ */
+std::vector<double> rozklad_lu::rozwiaz(const std::vector<double>& b) const {
+    if (static_cast<int>(b.size()) != n || osobliwa_) return std::vector<double>();
+    std::vector<double> x(n);
+    for (int i = 0; i < n; ++i) {
+        double s = b[perm[i]];
+        const double* wiersz = &lu[static_cast<std::size_t>(i) * n];
+        for (int j = 0; j < i; ++j) s -= wiersz[j] * x[j];
+        x[i] = s;
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        double s = x[i];
+        const double* wiersz = &lu[static_cast<std::size_t>(i) * n];
+        for (int j = i + 1; j < n; ++j) s -= wiersz[j] * x[j];
+        x[i] = s / wiersz[i];
+    }
+    return x;
+}
+
+/**
+ * @brief Element połączonej macierzy LU.
+ */
+double rozklad_lu::element(int x, int y) const {
+    if (x < 0 || x >= n || y < 0 || y >= n) return 0.0;
+    return lu[static_cast<std::size_t>(x) * n + y];
+}
@@ -0,0 +1,149 @@
+#ifndef MATRIX_LU_H
+#define MATRIX_LU_H
+
+#include <vector>
+#include "matrix.h"
+
+// --- Eliminacja Bareissa (dokładna, całkowitoliczbowa) ---
+// Eliminacja bez ułamków: w kroku k każdy element poniżej wiersza osiowego
+// zastępowany jest przez (a_kk · a_ij - a_ik · a_kj) / a_(k-1)(k-1), a dzielenie
+// jest zawsze dokładne (wynik to minor macierzy wejściowej). Iloczyny liczone są
+// w arytmetyce 128-bitowej, elementy przechowywane jako long long; jeśli któryś
+// minor nie mieści się w 64 bitach (lub ograniczenie Hadamarda przekracza 2¹²⁶,
+// co niemal przesądza o przepełnieniu), funkcje zgłaszają utratę dokładności.
+// wyznacznik_dokladny() przechodzi wtedy na metodę wielomodularną.
+
+/**
+ * @brief Wyznacznik metodą Bareissa.
+ * @param a Widok kwadratowy.
+ * @param wynik Wyznacznik (0 dla widoku niekwadratowego).
+ * @param watki Liczba wątków, między które dzielone są wiersze w każdym kroku.
+ * @return false, jeśli wartości pośrednie przekroczyły (lub według ograniczenia Hadamarda przekroczyłyby) zakres 64 bitów (wynik = 0).
+ */
+bool wyznacznik_bareiss(const_matrix_view a, long long& wynik, int watki);
+
+/**
+ * @brief Rząd metodą Bareissa (także dla widoków prostokątnych).
+ * @param a Widok wejściowy.
+ * @param wynik Rząd.
+ * @param watki Liczba wątków.
+ * @return false, jeśli wartości pośrednie przekroczyły (lub według ograniczenia Hadamarda przekroczyłyby) zakres 64 bitów (wynik = -1).
+ */
+bool rzad_bareiss(const_matrix_view a, int& wynik, int watki);
+
+/**
+ * @brief Dokładny wyznacznik dowolnej wielkości.
+ *
+ * Jeśli ograniczenie Hadamarda (iloczyn norm euklidesowych wierszy) nie wyklucza
+ * wyniku 64-bitowego, najpierw próbowana jest eliminacja Bareissa. W przeciwnym
+ * razie - lub po jej przepełnieniu - wyznacznik liczony jest modulo kolejne liczby
+ * pierwsze poniżej 2³¹ (równolegle, po jednej liczbie na wątek), aż iloczyn modułów
+ * przekroczy dwukrotność ograniczenia Hadamarda, po czym odtwarzany jest z reszt.
+ * Wynik jest zawsze dokładny.
+ *
+ * @param a Widok kwadratowy.
+ * @param watki Liczba wątków.
+ * @return Wyznacznik (0 dla widoku niekwadratowego, 1 dla pustego).
+ */
+duza_liczba wyznacznik_dokladny(const_matrix_view a, int watki);
+
+/**
+ * @brief Wyznacznik modulo p (eliminacja Gaussa modulo p).
+ * @param a Widok kwadratowy.
+ * @param p Moduł pierwszy, 2 ≤ p < 2³¹.
+ * @return Wyznacznik z przedziału [0, p); -1 dla p < 2 lub widoku niekwadratowego.
+ */
+int wyznacznik_mod(const_matrix_view a, int p);
+
+/**
+ * @brief Logarytm dwójkowy ograniczenia Hadamarda: Σ log₂ ‖wiersz_i‖ po wierszach niezerowych.
+ *
+ * Ogranicza moduł każdego minora macierzy, a więc także wyznacznika i wszystkich
+ * wartości pośrednich eliminacji Bareissa.
+ *
+ * @param a Widok wejściowy.
+ * @return Ograniczenie w bitach (0 dla macierzy zerowej).
+ */
+double bity_hadamarda(const_matrix_view a);
+
+/**
+ * @brief Rząd nad ciałem Z_p (eliminacja Gaussa modulo p).
+ *
+ * Nie przekracza rzędu nad liczbami wymiernymi i jest mu równy, o ile p nie dzieli
+ * odpowiednich minorów - dla dużego p prawie zawsze.
+ *
+ * @param a Widok wejściowy.
+ * @param p Moduł pierwszy, 2 ≤ p < 2³¹.
+ * @return Rząd modulo p (-1 dla p < 2).
+ */
+int rzad_mod(const_matrix_view a, int p);
+
+/**
+ * @class rozklad_lu
+ * @brief Rozkład PA = LU w arytmetyce zmiennoprzecinkowej z częściowym wyborem elementu głównego.
+ *
+ * Rozkład jest blokowy i prawostronny (right-looking): kolumny dzielone są na panele
+ * szerokości `blok`; panel rozkładany jest sekwencyjnie, wiersze U12 wyznaczane
+ * podstawianiem, a reszta macierzy aktualizowana jednym mnożeniem A22 -= L21 · U12
+ * liczonym kafelkami o boku `blok` i równolegle w pasach wierszy, tak jak
+ * mnoz_blokowo(). Rozmiar kafelka i liczba wątków pochodzą domyślnie ze strojenia
+ * mnożenia (matrix_tuning.h).
+ *
+ * L (z jedynkami na diagonali, bez zapisu) i U przechowywane są razem w jednej
+ * tablicy n×n typu double.
+ */
+class rozklad_lu {
+private:
+    std::vector<double> lu;     ///< Czynniki L (pod diagonalą) i U (diagonala i powyżej), wiersz po wierszu
+    std::vector<int> perm;      ///< perm[i] - wiersz macierzy wejściowej, który trafił na pozycję i
+    int n;                      ///< Rozmiar macierzy
+    int znak;                   ///< Znak permutacji (+1 lub -1)
+    bool osobliwa_;             ///< true, jeśli któryś element główny był zerem
+
+public:
+    /**
+     * @brief Rozkłada macierz a.
+     * @param a Macierz wejściowa.
+     * @param blok Szerokość panelu i bok kafelka (≤ 0 - wartość ze strojenia dla n).
+     * @param watki Liczba wątków aktualizacji (≤ 0 - wartość ze strojenia dla n).
+     */
+    explicit rozklad_lu(const matrix& a, int blok = 0, int watki = 0);
+
+    /**
+     * @brief Rozmiar rozłożonej macierzy.
+     */
+    int rozmiar() const { return n; }
+
+    /**
+     * @brief Czy macierz jest osobliwa (zerowy element główny).
+     */
+    bool osobliwa() const { return osobliwa_; }
+
+    /**
+     * @brief Wyznacznik: znak permutacji razy iloczyn diagonali U.
+     * @return Wyznacznik (dla dużych n może przekroczyć zakres double - wtedy ±inf).
+     */
+    double wyznacznik() const;
+
+    /**
+     * @brief Rozwiązuje układ A · x = b.
+     * @param b Prawa strona (n elementów).
+     * @return Rozwiązanie x; pusty wektor, jeśli rozmiar b się nie zgadza lub macierz jest osobliwa.
+     */
+    std::vector<double> rozwiaz(const std::vector<double>& b) const;
+
+    /**
+     * @brief Element połączonej macierzy LU.
+     * @param x Indeks wiersza.
+     * @param y Indeks kolumny.
+     * @return L[x][y] dla x > y, U[x][y] dla x ≤ y; 0 poza zakresem.
+     */
+    double element(int x, int y) const;
+
+    /**
+     * @brief Permutacja wierszy: wiersz i macierzy PA to wiersz permutacja()[i] macierzy A.
+     */
+    const std::vector<int>& permutacja() const { return perm; }
+};
+
+#endif
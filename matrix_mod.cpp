@@ -0,0 +1,261 @@
+#include "matrix_mod.h"
+#include "matrix_parallel.h"
+#include "matrix_simd.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// --- Funkcje pomocnicze ---
+
+/**
+ * @brief Sprowadza dowolną liczbę int do reprezentanta z przedziału [0, p).
+ */
+static uint32_t reszta(int v, int p) {
+    int r = v % p;
+    return static_cast<uint32_t>(r < 0 ? r + p : r);
+}
+
+/**
+ * @brief Sprawdza moduł oraz zgodność wymiarów dla operacji element po elemencie.
+ */
+static bool poprawne_argumenty(const_matrix_view dst, const_matrix_view a, const_matrix_view b, int p) {
+    return p >= 2 &&
+           a.liczba_wierszy() == b.liczba_wierszy() && a.liczba_kolumn() == b.liczba_kolumn() &&
+           dst.liczba_wierszy() == a.liczba_wierszy() && dst.liczba_kolumn() == a.liczba_kolumn();
+}
+
+// --- Mnożenie macierzowe ---
+
+namespace {
+
+const int WYSOKOSC_PASA = 16;       ///< Wiersze wyniku liczone razem - każdy fragment wiersza b użyty 16 razy
+const int SZEROKOSC_KAFELKA = 256;  ///< Kolumny akumulowane naraz (16 · 256 · 8 B = 32 KB akumulatorów)
+
+/**
+ * @brief Położenie kolumny j w akumulatorze kafelka.
+ *
+ * W każdej ósemce kolumn najpierw leżą kolumny parzyste, potem nieparzyste - tak,
+ * jak zwraca je pmuludq, który mnoży tylko parzyste kanały 32-bitowe.
+ */
+inline int polozenie(int j) {
+    return (j & ~7) | ((j & 1) << 2) | ((j & 7) >> 1);
+}
+
+/**
+ * @brief acc += a · b dla n kolumn (n podzielne przez 8), wersja skalarna.
+ */
+void dodaj_iloczyny(uint64_t* acc, uint32_t a, const uint32_t* b, int n) {
+    for (int j = 0; j < n; ++j) acc[polozenie(j)] += static_cast<uint64_t>(a) * b[j];
+}
+
+/**
+ * @brief Zwija akumulatory dwukrotnie: x → (x >> 32) · (2³² mod p) + (x mod 2³²).
+ *
+ * Reszta modulo p się nie zmienia, a wynik nie przekracza (p - 1)² + 2³² - 1.
+ */
+void zwin(uint64_t* acc, int n, uint32_t r32) {
+    for (int j = 0; j < n; ++j) {
+        uint64_t x = acc[j];
+        x = (x >> 32) * r32 + (x & 0xFFFFFFFFULL);
+        acc[j] = (x >> 32) * r32 + (x & 0xFFFFFFFFULL);
+    }
+}
+
+#if defined(__SSE2__)
+void dodaj_iloczyny_sse2(uint64_t* acc, uint32_t a, const uint32_t* b, int n) {
+    const __m128i va = _mm_set1_epi32(static_cast<int>(a));
+    for (int j = 0; j < n; j += 8) {
+        __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j + 4));
+        __m128i* s = reinterpret_cast<__m128i*>(acc + j);
+        _mm_storeu_si128(s + 0, _mm_add_epi64(_mm_loadu_si128(s + 0), _mm_mul_epu32(v0, va)));
+        _mm_storeu_si128(s + 1, _mm_add_epi64(_mm_loadu_si128(s + 1), _mm_mul_epu32(v1, va)));
+        _mm_storeu_si128(s + 2, _mm_add_epi64(_mm_loadu_si128(s + 2), _mm_mul_epu32(_mm_srli_epi64(v0, 32), va)));
+        _mm_storeu_si128(s + 3, _mm_add_epi64(_mm_loadu_si128(s + 3), _mm_mul_epu32(_mm_srli_epi64(v1, 32), va)));
+    }
+}
+
+void zwin_sse2(uint64_t* acc, int n, uint32_t r32) {
+    const __m128i vr = _mm_set1_epi32(static_cast<int>(r32));
+    const __m128i niskie = _mm_set1_epi64x(0xFFFFFFFFLL);
+    for (int j = 0; j < n; j += 2) {
+        __m128i* s = reinterpret_cast<__m128i*>(acc + j);
+        __m128i x = _mm_loadu_si128(s);
+        x = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(x, 32), vr), _mm_and_si128(x, niskie));
+        x = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(x, 32), vr), _mm_and_si128(x, niskie));
+        _mm_storeu_si128(s, x);
+    }
+}
+#endif
+
+#if MATRIX_SIMD_X86
+CEL_AVX2 void dodaj_iloczyny_avx2(uint64_t* acc, uint32_t a, const uint32_t* b, int n) {
+    const __m256i va = _mm256_set1_epi32(static_cast<int>(a));
+    for (int j = 0; j < n; j += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+        __m256i* s = reinterpret_cast<__m256i*>(acc + j);
+        _mm256_storeu_si256(s + 0, _mm256_add_epi64(_mm256_loadu_si256(s + 0), _mm256_mul_epu32(v, va)));
+        _mm256_storeu_si256(s + 1, _mm256_add_epi64(_mm256_loadu_si256(s + 1),
+                                                    _mm256_mul_epu32(_mm256_srli_epi64(v, 32), va)));
+    }
+}
+
+CEL_AVX2 void zwin_avx2(uint64_t* acc, int n, uint32_t r32) {
+    const __m256i vr = _mm256_set1_epi32(static_cast<int>(r32));
+    const __m256i niskie = _mm256_set1_epi64x(0xFFFFFFFFLL);
+    for (int j = 0; j < n; j += 4) {
+        __m256i* s = reinterpret_cast<__m256i*>(acc + j);
+        __m256i x = _mm256_loadu_si256(s);
+        x = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), vr), _mm256_and_si256(x, niskie));
+        x = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), vr), _mm256_and_si256(x, niskie));
+        _mm256_storeu_si256(s, x);
+    }
+}
+#endif
+
+} // namespace
+
+/**
+ * @brief Mnożenie macierzowe modulo p (dst = a · b mod p) z opóźnioną redukcją.
+ *
+ * Obie macierze są najpierw sprowadzane do ciągłych buforów reszt 32-bitowych
+ * (wiersze b uzupełnione zerami do wielokrotności 8). Wynik liczony jest pasami
+ * po WYSOKOSC_PASA wierszy, rozdzielanymi między wątki jak w mnoz_blokowo(), i
+ * kafelkami po SZEROKOSC_KAFELKA kolumn: akumulatory 64-bitowe całego kafelka
+ * mieszczą się w L1, a każdy fragment wiersza b jest użyty dla wszystkich wierszy pasa.
+ *
+ * Iloczyny 32×32→64 i sumy liczone są instrukcjami pmuludq (SSE2 lub, jeśli procesor
+ * go obsługuje, AVX2). Po każdym bloku `dlugosc_bloku` składników akumulatory są
+ * zwijane wektorowo (zwin()) poniżej (p - 1)² + 2³², co gwarantuje brak przepełnienia;
+ * pełna redukcja Barretta wykonywana jest raz na element wyniku.
+ *
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ * @param watki Liczba wątków (≤ 1 - sekwencyjnie).
+ */
+void mnoz_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p, int watki) {
+    int h = a.liczba_wierszy();
+    int k = a.liczba_kolumn();
+    int w = b.liczba_kolumn();
+    if (p < 2 || b.liczba_wierszy() != k || dst.liczba_wierszy() != h || dst.liczba_kolumn() != w) return;
+    if (h == 0 || w == 0) return;
+
+    barrett red(static_cast<uint32_t>(p));
+    uint32_t r32 = static_cast<uint32_t>((1ULL << 32) % static_cast<uint64_t>(p));
+    uint64_t max_iloczyn = static_cast<uint64_t>(p - 1) * static_cast<uint64_t>(p - 1);
+    uint64_t po_zwinieciu = max_iloczyn + 0xFFFFFFFFULL;
+    uint64_t dlugosc_bloku = (~0ULL - po_zwinieciu) / max_iloczyn;
+    if (dlugosc_bloku > static_cast<uint64_t>(k)) dlugosc_bloku = static_cast<uint64_t>(k) + 1;
+
+    auto dodaj = dodaj_iloczyny;
+    auto zwijaj = zwin;
+#if defined(__SSE2__)
+    dodaj = dodaj_iloczyny_sse2;
+    zwijaj = zwin_sse2;
+#endif
+#if MATRIX_SIMD_X86
+    if (procesor_ma_avx2()) {
+        dodaj = dodaj_iloczyny_avx2;
+        zwijaj = zwin_avx2;
+    }
+#endif
+
+    int wp = (w + 7) / 8 * 8;
+    std::vector<uint32_t> ra(static_cast<std::size_t>(h) * k);
+    std::vector<uint32_t> rb(static_cast<std::size_t>(k) * wp, 0);
+    rownolegle(0, h, watki, [&](int od, int do_) {
+        for (int i = od; i < do_; ++i)
+            for (int q = 0; q < k; ++q) ra[static_cast<std::size_t>(i) * k + q] = reszta(a(i, q), p);
+    });
+    rownolegle(0, k, watki, [&](int od, int do_) {
+        for (int q = od; q < do_; ++q)
+            for (int j = 0; j < w; ++j) rb[static_cast<std::size_t>(q) * wp + j] = reszta(b(q, j), p);
+    });
+
+    int pasy = (h + WYSOKOSC_PASA - 1) / WYSOKOSC_PASA;
+    rownolegle(0, pasy, watki, [&](int od, int do_) {
+        std::vector<uint64_t> akumulator(static_cast<std::size_t>(WYSOKOSC_PASA) * SZEROKOSC_KAFELKA);
+        for (int ib = od; ib < do_; ++ib) {
+            int i0 = ib * WYSOKOSC_PASA;
+            int ih = std::min(WYSOKOSC_PASA, h - i0);
+            for (int j0 = 0; j0 < wp; j0 += SZEROKOSC_KAFELKA) {
+                int jw = std::min(SZEROKOSC_KAFELKA, wp - j0);
+                std::fill(akumulator.begin(), akumulator.end(), 0);
+                uint64_t w_bloku = 0;
+                for (int q = 0; q < k; ++q) {
+                    const uint32_t* wiersz_b = &rb[static_cast<std::size_t>(q) * wp + j0];
+                    for (int r = 0; r < ih; ++r) {
+                        uint32_t aiq = ra[static_cast<std::size_t>(i0 + r) * k + q];
+                        if (aiq != 0) dodaj(&akumulator[static_cast<std::size_t>(r) * SZEROKOSC_KAFELKA], aiq, wiersz_b, jw);
+                    }
+                    if (++w_bloku == dlugosc_bloku) {
+                        for (int r = 0; r < ih; ++r) zwijaj(&akumulator[static_cast<std::size_t>(r) * SZEROKOSC_KAFELKA], jw, r32);
+                        w_bloku = 0;
+                    }
+                }
+                int jk = std::min(jw, w - j0);
+                for (int r = 0; r < ih; ++r) {
+                    const uint64_t* wiersz = &akumulator[static_cast<std::size_t>(r) * SZEROKOSC_KAFELKA];
+                    for (int j = 0; j < jk; ++j) dst(i0 + r, j0 + j) = static_cast<int>(red.redukuj(wiersz[polozenie(j)]));
+                }
+            }
+        }
+    });
+}
+
+// --- Operacje element po elemencie ---
+
+/**
+ * @brief Dodawanie element po elemencie modulo p (dst = a + b mod p).
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Pierwszy składnik.
+ * @param b Drugi składnik.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ */
+void dodaj_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p) {
+    if (!poprawne_argumenty(dst, a, b, p)) return;
+    for (int i = 0; i < dst.liczba_wierszy(); ++i) {
+        for (int j = 0; j < dst.liczba_kolumn(); ++j) {
+            uint32_t s = reszta(a(i, j), p) + reszta(b(i, j), p);
+            dst(i, j) = static_cast<int>(s >= static_cast<uint32_t>(p) ? s - p : s);
+        }
+    }
+}
+
+/**
+ * @brief Odejmowanie element po elemencie modulo p (dst = a - b mod p).
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Odjemna.
+ * @param b Odjemnik.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ */
+void odejmij_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p) {
+    if (!poprawne_argumenty(dst, a, b, p)) return;
+    for (int i = 0; i < dst.liczba_wierszy(); ++i) {
+        for (int j = 0; j < dst.liczba_kolumn(); ++j) {
+            uint32_t x = reszta(a(i, j), p);
+            uint32_t y = reszta(b(i, j), p);
+            dst(i, j) = static_cast<int>(x >= y ? x - y : x + (p - y));
+        }
+    }
+}
+
+/**
+ * @brief Mnożenie element po elemencie (iloczyn Hadamarda) modulo p.
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Pierwszy czynnik.
+ * @param b Drugi czynnik.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ */
+void hadamard_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p) {
+    if (!poprawne_argumenty(dst, a, b, p)) return;
+    barrett red(static_cast<uint32_t>(p));
+    for (int i = 0; i < dst.liczba_wierszy(); ++i) {
+        for (int j = 0; j < dst.liczba_kolumn(); ++j) {
+            uint64_t iloczyn = static_cast<uint64_t>(reszta(a(i, j), p)) * reszta(b(i, j), p);
+            dst(i, j) = static_cast<int>(red.redukuj(iloczyn));
+        }
+    }
+}
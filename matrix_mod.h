@@ -0,0 +1,101 @@
+#ifndef MATRIX_MOD_H
+#define MATRIX_MOD_H
+
+#include <cstdint>
+#include "matrix_view.h"
+
+/**
+ * @struct barrett
+ * @brief Redukcja Barretta: szybkie x mod p dla 64-bitowego x bez dzielenia sprzętowego.
+ *
+ * Odwrotność m = ⌊(2⁶⁴ - 1) / p⌋ liczona jest raz przy konstrukcji; każda redukcja
+ * to jedno mnożenie 64×64→128, jedno mnożenie 64-bitowe i co najwyżej dwie korekty.
+ */
+struct barrett {
+    uint64_t p; ///< Moduł (2 ≤ p < 2³¹)
+    uint64_t m; ///< Przybliżona odwrotność ⌊(2⁶⁴ - 1) / p⌋
+
+    /**
+     * @brief Przygotowuje stałe redukcji dla modułu p.
+     * @param p Moduł, 2 ≤ p < 2³¹.
+     */
+    explicit barrett(uint32_t p) : p(p), m(~0ULL / p) {}
+
+    /**
+     * @brief Zwraca x mod p.
+     * @param x Dowolna liczba 64-bitowa bez znaku.
+     * @return Reszta z przedziału [0, p).
+     */
+    uint32_t redukuj(uint64_t x) const {
+        uint64_t q = static_cast<uint64_t>((static_cast<unsigned __int128>(x) * m) >> 64);
+        uint64_t r = x - q * p;
+        while (r >= p) r -= p;
+        return static_cast<uint32_t>(r);
+    }
+
+    /**
+     * @brief Zwraca x^k mod p (potęgowanie przez podnoszenie do kwadratu).
+     * @param x Podstawa z przedziału [0, p).
+     * @param k Wykładnik; dla pierwszego p potega(x, p - 2) to odwrotność x.
+     */
+    uint32_t potega(uint32_t x, uint32_t k) const {
+        uint64_t wynik = 1, b = x;
+        while (k > 0) {
+            if (k & 1) wynik = redukuj(wynik * b);
+            b = redukuj(b * b);
+            k >>= 1;
+        }
+        return static_cast<uint32_t>(wynik);
+    }
+};
+
+// --- Jądra modularne na widokach ---
+// Elementy wejściowe mogą być dowolnymi liczbami int (także ujemnymi) - przed
+// obliczeniami są sprowadzane do reprezentantów z przedziału [0, p).
+// Przy p < 2 lub niezgodnych wymiarach jądra nie robią nic.
+
+/**
+ * @brief Mnożenie macierzowe modulo p (dst = a · b mod p) z opóźnioną redukcją.
+ *
+ * Iloczyny reszt akumulowane są w liczbach 64-bitowych instrukcjami SSE2/AVX2;
+ * akumulatory są wektorowo zwijane raz na blok tylu składników, ile mieści się
+ * w 64 bitach bez przepełnienia (dla p ≈ 10⁹ jest to 17 składników, dla p < 2¹⁶ -
+ * cały wiersz), a redukcja Barretta wykonywana jest raz na element wyniku.
+ * Pasy wierszy wyniku rozdzielane są między wątki.
+ *
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ * @param watki Liczba wątków (≤ 1 - sekwencyjnie).
+ */
+void mnoz_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p, int watki = 1);
+
+/**
+ * @brief Dodawanie element po elemencie modulo p (dst = a + b mod p).
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Pierwszy składnik.
+ * @param b Drugi składnik.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ */
+void dodaj_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p);
+
+/**
+ * @brief Odejmowanie element po elemencie modulo p (dst = a - b mod p).
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Odjemna.
+ * @param b Odjemnik.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ */
+void odejmij_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p);
+
+/**
+ * @brief Mnożenie element po elemencie (iloczyn Hadamarda) modulo p.
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Pierwszy czynnik.
+ * @param b Drugi czynnik.
+ * @param p Moduł, 2 ≤ p < 2³¹.
+ */
+void hadamard_mod(matrix_view dst, const_matrix_view a, const_matrix_view b, int p);
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef MATRIX_PARALLEL_H
+#define MATRIX_PARALLEL_H
+
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Zwraca liczbę wątków sprzętowych (co najmniej 1).
+ */
+inline int liczba_watkow_sprzetowych() {
+    unsigned w = std::thread::hardware_concurrency();
+    return w == 0 ? 1 : static_cast<int>(w);
+}
+
+/**
+ * @brief Dzieli zakres [poczatek, koniec) na równe części i wykonuje je równolegle.
+ *
+ * Każdy fragment otrzymuje własny wątek std::thread; ostatni fragment wykonywany
+ * jest w wątku wywołującym. Funkcja celowo nie korzysta z puli wykonawca, aby
+ * operacje synchroniczne wywołane z wnętrza zadań asynchronicznych nie czekały
+ * na wątki tej samej puli.
+ *
+ * @param poczatek Pierwszy indeks zakresu.
+ * @param koniec Indeks za ostatnim elementem zakresu.
+ * @param watki Maksymalna liczba wątków (≤ 1 oznacza wykonanie sekwencyjne).
+ * @param f Funkcja wywoływana jako f(od, do) dla każdego fragmentu.
+ */
+template <typename F>
+void rownolegle(int poczatek, int koniec, int watki, F f) {
+    int dlugosc = koniec - poczatek;
+    if (dlugosc <= 0) return;
+    if (watki > dlugosc) watki = dlugosc;
+    if (watki <= 1) {
+        f(poczatek, koniec);
+        return;
+    }
+    std::vector<std::thread> pracownicy;
+    pracownicy.reserve(watki - 1);
+    int od = poczatek;
+    for (int t = 0; t < watki; ++t) {
+        int do_ = poczatek + static_cast<int>(static_cast<long long>(dlugosc) * (t + 1) / watki);
+        if (t == watki - 1) f(od, do_);
+        else pracownicy.emplace_back(f, od, do_);
+        od = do_;
+    }
+    for (auto& p : pracownicy) p.join();
+}
+
+#endif
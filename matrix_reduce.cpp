@@ -0,0 +1,427 @@
+#include "matrix_reduce.h"
+#include "matrix_parallel.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+#include "matrix_simd.h"
+
+namespace {
+
+const long long ELEMENTY_NA_WATEK = 1LL << 18; ///< Około 1 MB danych na wątek
+
+/**
+ * @brief Wykonuje f(od, do_) na rozłącznych zakresach wierszy i łączy wyniki częściowe.
+ *
+ * @param h Liczba wierszy.
+ * @param watki Liczba wątków.
+ * @param wynik Wartość początkowa (element neutralny).
+ * @param f Funkcja (od, do_) -> T licząca wynik dla wierszy [od, do_).
+ * @param polacz Funkcja (T& wynik, const T& czesc) dołączająca wynik częściowy.
+ */
+template <typename T, typename F, typename P>
+T redukuj_wiersze(int h, int watki, T wynik, F f, P polacz) {
+    std::mutex blokada;
+    rownolegle(0, h, watki, [&](int od, int do_) {
+        T czesc = f(od, do_);
+        std::lock_guard<std::mutex> lock(blokada);
+        polacz(wynik, czesc);
+    });
+    return wynik;
+}
+
+#if defined(__SSE2__)
+long long suma_kanalow64(__m128i v) {
+    alignas(16) long long t[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(t), v);
+    return t[0] + t[1];
+}
+#endif
+
+#if MATRIX_SIMD_X86
+// Warianty AVX2 - wybierane w czasie wykonania, jeśli procesor je obsługuje
+
+CEL_AVX2 inline long long suma_kanalow64(__m256i v) {
+    alignas(32) long long t[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(t), v);
+    return t[0] + t[1] + t[2] + t[3];
+}
+
+CEL_AVX2 long long suma_wiersza_avx2(const int* p, int w) {
+    int j = 0;
+    __m256i acc = _mm256_setzero_si256();
+    for (; j + 8 <= w; j += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + j));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    long long s = suma_kanalow64(acc);
+    for (; j < w; ++j) s += p[j];
+    return s;
+}
+
+CEL_AVX2 long long suma_modulow_wiersza_avx2(const int* p, int w) {
+    int j = 0;
+    __m256i acc = _mm256_setzero_si256();
+    for (; j + 8 <= w; j += 8) {
+        __m256i v = _mm256_abs_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + j)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    long long s = suma_kanalow64(acc);
+    for (; j < w; ++j) s += std::llabs(static_cast<long long>(p[j]));
+    return s;
+}
+
+CEL_AVX2 int zera_wiersza_avx2(const int* p, int w) {
+    int j = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc = _mm256_setzero_si256();
+    for (; j + 8 <= w; j += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + j));
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(v, zero));
+    }
+    alignas(32) int t[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(t), acc);
+    int z = 0;
+    for (int q = 0; q < 8; ++q) z += t[q];
+    for (; j < w; ++j) z += (p[j] == 0);
+    return z;
+}
+
+template <bool Maks>
+CEL_AVX2 int skrajny_wiersza_avx2(const int* p, int w) {
+    int m = p[0];
+    int j = 0;
+    if (w >= 8) {
+        __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        for (j = 8; j + 8 <= w; j += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + j));
+            acc = Maks ? _mm256_max_epi32(acc, v) : _mm256_min_epi32(acc, v);
+        }
+        alignas(32) int t[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(t), acc);
+        for (int q = 0; q < 8; ++q) m = Maks ? std::max(m, t[q]) : std::min(m, t[q]);
+    }
+    for (; j < w; ++j) m = Maks ? std::max(m, p[j]) : std::min(m, p[j]);
+    return m;
+}
+#endif
+
+/**
+ * @brief Suma ciągłego wiersza; elementy rozszerzane są do 64 bitów przed dodaniem.
+ */
+long long suma_wiersza(const int* p, int w) {
+#if MATRIX_SIMD_X86
+    if (procesor_ma_avx2()) return suma_wiersza_avx2(p, w);
+#endif
+    long long s = 0;
+    int j = 0;
+#if defined(__SSE2__)
+    __m128i acc = _mm_setzero_si128();
+    for (; j + 4 <= w; j += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + j));
+        __m128i znak = _mm_srai_epi32(v, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, znak));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, znak));
+    }
+    s = suma_kanalow64(acc);
+#endif
+    for (; j < w; ++j) s += p[j];
+    return s;
+}
+
+/**
+ * @brief Suma wartości bezwzględnych ciągłego wiersza (|INT_MIN| = 2³¹ liczone poprawnie).
+ */
+long long suma_modulow_wiersza(const int* p, int w) {
+#if MATRIX_SIMD_X86
+    if (procesor_ma_avx2()) return suma_modulow_wiersza_avx2(p, w);
+#endif
+    long long s = 0;
+    int j = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    for (; j + 4 <= w; j += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + j));
+        __m128i znak = _mm_srai_epi32(v, 31);
+        v = _mm_sub_epi32(_mm_xor_si128(v, znak), znak);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, zero));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, zero));
+    }
+    s = suma_kanalow64(acc);
+#endif
+    for (; j < w; ++j) s += std::llabs(static_cast<long long>(p[j]));
+    return s;
+}
+
+/**
+ * @brief Liczba zer w ciągłym wierszu (maska porównania -1 odejmowana od licznika).
+ */
+int zera_wiersza(const int* p, int w) {
+#if MATRIX_SIMD_X86
+    if (procesor_ma_avx2()) return zera_wiersza_avx2(p, w);
+#endif
+    int z = 0;
+    int j = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    for (; j + 4 <= w; j += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + j));
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, zero));
+    }
+    alignas(16) int t[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(t), acc);
+    for (int q = 0; q < 4; ++q) z += t[q];
+#endif
+    for (; j < w; ++j) z += (p[j] == 0);
+    return z;
+}
+
+/**
+ * @brief Najmniejsza (Maks = false) lub największa (Maks = true) wartość ciągłego wiersza.
+ *
+ * SSE2 nie ma pminsd/pmaxsd, więc wybór realizowany jest maską porównania.
+ */
+template <bool Maks>
+int skrajny_wiersza(const int* p, int w) {
+#if MATRIX_SIMD_X86
+    if (procesor_ma_avx2()) return skrajny_wiersza_avx2<Maks>(p, w);
+#endif
+    int m = p[0];
+    int j = 0;
+#if defined(__SSE2__)
+    if (w >= 4) {
+        __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        for (j = 4; j + 4 <= w; j += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + j));
+            __m128i wez_v = Maks ? _mm_cmpgt_epi32(v, acc) : _mm_cmpgt_epi32(acc, v);
+            acc = _mm_or_si128(_mm_and_si128(wez_v, v), _mm_andnot_si128(wez_v, acc));
+        }
+        alignas(16) int t[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(t), acc);
+        for (int q = 0; q < 4; ++q) m = Maks ? std::max(m, t[q]) : std::min(m, t[q]);
+    }
+#endif
+    for (; j < w; ++j) m = Maks ? std::max(m, p[j]) : std::min(m, p[j]);
+    return m;
+}
+
+/**
+ * @brief Wspólna implementacja minimum() i maksimum().
+ *
+ * Wartość skrajna wiersza liczona jest wektorowo; jej kolumna wyszukiwana jest tylko
+ * wtedy, gdy wiersz poprawia dotychczasowy wynik, więc zwykle każdy wiersz czytany jest raz.
+ */
+template <bool Maks>
+element_skrajny skrajny(const_matrix_view a, int watki) {
+    int h = a.liczba_wierszy();
+    int w = a.liczba_kolumn();
+    element_skrajny brak = {0, -1, -1};
+    if (h == 0 || w == 0) return brak;
+    auto lepszy = [](int x, int y) { return Maks ? x > y : x < y; };
+
+    return redukuj_wiersze(h, watki, brak,
+        [&](int od, int do_) {
+            element_skrajny e = brak;
+            for (int i = od; i < do_; ++i) {
+                const int* p = &a(i, 0);
+                int k = a.krok_kolumny();
+                int m;
+                if (k == 1) {
+                    m = skrajny_wiersza<Maks>(p, w);
+                } else {
+                    m = p[0];
+                    for (int j = 1; j < w; ++j) if (lepszy(p[j * k], m)) m = p[j * k];
+                }
+                if (e.wiersz < 0 || lepszy(m, e.wartosc)) {
+                    int j = 0;
+                    while (p[j * k] != m) ++j;
+                    e = {m, i, j};
+                }
+            }
+            return e;
+        },
+        [&](element_skrajny& e, const element_skrajny& c) {
+            if (c.wiersz < 0) return;
+            if (e.wiersz < 0 || lepszy(c.wartosc, e.wartosc) ||
+                (c.wartosc == e.wartosc && c.wiersz < e.wiersz)) e = c;
+        });
+}
+
+// --- Skrót ---
+
+const std::uint64_t P1 = 11400714785074694791ULL;
+const std::uint64_t P2 = 14029467366897019727ULL;
+const std::uint64_t P3 = 1609587929392839161ULL;
+const std::uint64_t P5 = 2870177450012600261ULL;
+
+inline std::uint64_t obrot(std::uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+/**
+ * @brief Runda mieszająca xxHash64: acc = rotl(acc + v·P2, 31) · P1.
+ */
+inline std::uint64_t runda(std::uint64_t acc, std::uint64_t v) {
+    return obrot(acc + v * P2, 31) * P1;
+}
+
+/**
+ * @brief Końcowe wymieszanie bitów (avalanche) xxHash64.
+ */
+inline std::uint64_t wymieszaj(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+inline std::uint64_t para(int x, int y) {
+    return static_cast<std::uint32_t>(x) | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(y)) << 32);
+}
+
+/**
+ * @brief Skrót jednego wiersza: cztery niezależne tory po dwa elementy na rundę.
+ */
+std::uint64_t skrot_wiersza(const int* p, int w, int k, std::uint64_t ziarno) {
+    std::uint64_t s0 = ziarno + P1 + P2, s1 = ziarno + P2, s2 = ziarno, s3 = ziarno - P1;
+    int j = 0;
+    for (; j + 8 <= w; j += 8) {
+        s0 = runda(s0, para(p[j * k], p[(j + 1) * k]));
+        s1 = runda(s1, para(p[(j + 2) * k], p[(j + 3) * k]));
+        s2 = runda(s2, para(p[(j + 4) * k], p[(j + 5) * k]));
+        s3 = runda(s3, para(p[(j + 6) * k], p[(j + 7) * k]));
+    }
+    std::uint64_t h = obrot(s0, 1) + obrot(s1, 7) + obrot(s2, 12) + obrot(s3, 18);
+    for (; j < w; ++j) h = runda(h, static_cast<std::uint32_t>(p[j * k]));
+    return wymieszaj(h);
+}
+
+} // namespace
+
+// --- Redukcje ---
+
+/**
+ * @brief Dobiera liczbę wątków dla redukcji o zadanej liczbie elementów.
+ */
+int watki_redukcji(long long elementy) {
+    long long w = elementy / ELEMENTY_NA_WATEK;
+    return static_cast<int>(std::max(1LL, std::min<long long>(w, liczba_watkow_sprzetowych())));
+}
+
+/**
+ * @brief Suma wszystkich elementów w arytmetyce 64-bitowej.
+ */
+long long suma(const_matrix_view a, int watki) {
+    int w = a.liczba_kolumn();
+    if (w == 0) return 0;
+    return redukuj_wiersze(a.liczba_wierszy(), watki, 0LL,
+        [&](int od, int do_) {
+            long long s = 0;
+            for (int i = od; i < do_; ++i) {
+                if (a.krok_kolumny() == 1) s += suma_wiersza(&a(i, 0), w);
+                else for (int j = 0; j < w; ++j) s += a(i, j);
+            }
+            return s;
+        },
+        [](long long& s, long long c) { s += c; });
+}
+
+/**
+ * @brief Najmniejszy element i jego położenie.
+ */
+element_skrajny minimum(const_matrix_view a, int watki) {
+    return skrajny<false>(a, watki);
+}
+
+/**
+ * @brief Największy element i jego położenie.
+ */
+element_skrajny maksimum(const_matrix_view a, int watki) {
+    return skrajny<true>(a, watki);
+}
+
+/**
+ * @brief Norma ‖A‖₁ - sumy kolumn liczone są przez każdy wątek lokalnie i scalane na końcu.
+ */
+long long norma_l1(const_matrix_view a, int watki) {
+    int w = a.liczba_kolumn();
+    std::vector<long long> kolumny = redukuj_wiersze(a.liczba_wierszy(), watki,
+        std::vector<long long>(w, 0),
+        [&](int od, int do_) {
+            std::vector<long long> s(w, 0);
+            for (int i = od; i < do_; ++i)
+                for (int j = 0; j < w; ++j) s[j] += std::llabs(static_cast<long long>(a(i, j)));
+            return s;
+        },
+        [](std::vector<long long>& s, const std::vector<long long>& c) {
+            for (std::size_t j = 0; j < s.size(); ++j) s[j] += c[j];
+        });
+    long long m = 0;
+    for (long long s : kolumny) m = std::max(m, s);
+    return m;
+}
+
+/**
+ * @brief Norma ‖A‖∞ - największa suma wartości bezwzględnych w wierszu.
+ */
+long long norma_inf(const_matrix_view a, int watki) {
+    int w = a.liczba_kolumn();
+    if (w == 0) return 0;
+    return redukuj_wiersze(a.liczba_wierszy(), watki, 0LL,
+        [&](int od, int do_) {
+            long long m = 0;
+            for (int i = od; i < do_; ++i) {
+                long long s = 0;
+                if (a.krok_kolumny() == 1) s = suma_modulow_wiersza(&a(i, 0), w);
+                else for (int j = 0; j < w; ++j) s += std::llabs(static_cast<long long>(a(i, j)));
+                m = std::max(m, s);
+            }
+            return m;
+        },
+        [](long long& m, long long c) { m = std::max(m, c); });
+}
+
+/**
+ * @brief Liczba elementów różnych od zera.
+ */
+long long niezerowe(const_matrix_view a, int watki) {
+    int w = a.liczba_kolumn();
+    if (w == 0) return 0;
+    return redukuj_wiersze(a.liczba_wierszy(), watki, 0LL,
+        [&](int od, int do_) {
+            long long z = 0;
+            for (int i = od; i < do_; ++i) {
+                if (a.krok_kolumny() == 1) z += w - zera_wiersza(&a(i, 0), w);
+                else for (int j = 0; j < w; ++j) z += (a(i, j) != 0);
+            }
+            return z;
+        },
+        [](long long& z, long long c) { z += c; });
+}
+
+/**
+ * @brief 64-bitowy skrót zawartości i wymiarów widoku.
+ *
+ * Skróty wierszy liczone są równolegle do wspólnej tablicy, a następnie łączone
+ * kolejno w jednym wątku, dzięki czemu wynik nie zależy od podziału pracy.
+ */
+std::uint64_t skrot(const_matrix_view a, int watki) {
+    int h = a.liczba_wierszy();
+    int w = a.liczba_kolumn();
+    std::uint64_t ziarno = wymieszaj(para(h, w) * P1 + P5);
+    std::vector<std::uint64_t> wiersze(h);
+    if (w > 0) {
+        rownolegle(0, h, watki, [&](int od, int do_) {
+            for (int i = od; i < do_; ++i) wiersze[i] = skrot_wiersza(&a(i, 0), w, a.krok_kolumny(), ziarno);
+        });
+    }
+    std::uint64_t wynik = ziarno;
+    for (std::uint64_t s : wiersze) wynik = runda(wynik, s);
+    wynik = wymieszaj(wynik);
+    return wynik == 0 ? 1 : wynik;
+}
@@ -0,0 +1,90 @@
+#ifndef MATRIX_REDUCE_H
+#define MATRIX_REDUCE_H
+
+#include <cstdint>
+#include "matrix_view.h"
+
+// --- Redukcje na widokach ---
+// Wiersze widoku dzielone są między `watki` wątków; wiersze o kroku kolumny 1
+// przetwarzane są instrukcjami SSE2 lub - jeśli procesor je obsługuje, co sprawdzane
+// jest w czasie wykonania - AVX2; pozostałe skalarnie.
+// Wynik nie zależy od liczby wątków.
+
+/**
+ * @struct element_skrajny
+ * @brief Wartość najmniejszego lub największego elementu wraz z jego położeniem.
+ */
+struct element_skrajny {
+    int wartosc; ///< Wartość elementu (0 dla pustego widoku)
+    int wiersz;  ///< Indeks wiersza pierwszego wystąpienia (-1 dla pustego widoku)
+    int kolumna; ///< Indeks kolumny pierwszego wystąpienia (-1 dla pustego widoku)
+};
+
+/**
+ * @brief Dobiera liczbę wątków dla redukcji o zadanej liczbie elementów.
+ *
+ * Redukcje są ograniczone przepustowością pamięci, więc wątek opłaca się dopiero
+ * przy kilkuset tysiącach elementów.
+ *
+ * @param elementy Liczba elementów do przejrzenia.
+ * @return Liczba wątków z przedziału [1, liczba_watkow_sprzetowych()].
+ */
+int watki_redukcji(long long elementy);
+
+/**
+ * @brief Suma wszystkich elementów (w arytmetyce 64-bitowej, bez przepełnienia).
+ * @param a Widok wejściowy.
+ * @param watki Liczba wątków.
+ */
+long long suma(const_matrix_view a, int watki);
+
+/**
+ * @brief Najmniejszy element; przy remisie pierwszy w porządku wierszowym.
+ * @param a Widok wejściowy.
+ * @param watki Liczba wątków.
+ */
+element_skrajny minimum(const_matrix_view a, int watki);
+
+/**
+ * @brief Największy element; przy remisie pierwszy w porządku wierszowym.
+ * @param a Widok wejściowy.
+ * @param watki Liczba wątków.
+ */
+element_skrajny maksimum(const_matrix_view a, int watki);
+
+/**
+ * @brief Norma indukowana ‖A‖₁: największa suma wartości bezwzględnych w kolumnie.
+ * @param a Widok wejściowy.
+ * @param watki Liczba wątków.
+ */
+long long norma_l1(const_matrix_view a, int watki);
+
+/**
+ * @brief Norma indukowana ‖A‖∞: największa suma wartości bezwzględnych w wierszu.
+ * @param a Widok wejściowy.
+ * @param watki Liczba wątków.
+ */
+long long norma_inf(const_matrix_view a, int watki);
+
+/**
+ * @brief Liczba elementów różnych od zera.
+ * @param a Widok wejściowy.
+ * @param watki Liczba wątków.
+ */
+long long niezerowe(const_matrix_view a, int watki);
+
+/**
+ * @brief 64-bitowy skrót zawartości i wymiarów widoku.
+ *
+ * Wiersze mieszane są niezależnie (rundy w stylu xxHash64 na czterech torach),
+ * a skróty wierszy łączone kolejno, więc wynik zależy od kolejności elementów,
+ * ale nie od liczby wątków ani od kroków widoku. Skrót nie jest kryptograficzny -
+ * równe skróty nie dowodzą równości, różne dowodzą nierówności.
+ *
+ * @param a Widok wejściowy.
+ * @param watki Liczba wątków.
+ * @return Skrót różny od 0.
+ */
+std::uint64_t skrot(const_matrix_view a, int watki);
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef MATRIX_SIMD_H
+#define MATRIX_SIMD_H
+
+// --- Wybór jąder SIMD w czasie wykonania ---
+// Ścieżki SSE2 kompilowane są zawsze, gdy kompilator je dopuszcza (x86-64 ma SSE2
+// w bazowym zestawie instrukcji). Jądra SSSE3 i AVX2 kompilowane są jako osobne
+// funkcje z atrybutem target(...) - bez flag -m w poleceniu budowania - i wybierane
+// dopiero po sprawdzeniu procesora przez __builtin_cpu_supports.
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+
+#define MATRIX_SIMD_X86 1                               ///< Dostępne jądra z wyborem w czasie wykonania
+#define CEL_SSSE3 __attribute__((target("ssse3")))      ///< Funkcja kompilowana dla SSSE3
+#define CEL_AVX2 __attribute__((target("avx2")))        ///< Funkcja kompilowana dla AVX2
+
+/**
+ * @brief Czy procesor obsługuje SSSE3 (pmaddubsw).
+ */
+inline bool procesor_ma_ssse3() {
+    static const bool jest = __builtin_cpu_supports("ssse3");
+    return jest;
+}
+
+/**
+ * @brief Czy procesor obsługuje AVX2 (256-bitowe operacje całkowite).
+ */
+inline bool procesor_ma_avx2() {
+    static const bool jest = __builtin_cpu_supports("avx2");
+    return jest;
+}
+
+#else
+#define MATRIX_SIMD_X86 0
+
+inline bool procesor_ma_ssse3() { return false; }
+inline bool procesor_ma_avx2() { return false; }
+#endif
+
+#endif
@@ -0,0 +1,331 @@
+#include "matrix_tuning.h"
+#include "matrix_gemm.h"
+#include "matrix_parallel.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <vector>
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+// --- Stan strojenia ---
+
+namespace {
+
+/**
+ * @struct tablica_strojenia
+ * @brief Parametry wszystkich klas rozmiarów wraz z blokadą i flagą wczytania.
+ */
+struct tablica_strojenia {
+    std::mutex blokada;
+    std::once_flag wczytano;
+    parametry_mnozenia klasy[strojenie::LICZBA_KLAS];
+
+    tablica_strojenia() {
+        int sprzet = liczba_watkow_sprzetowych();
+        for (int c = 0; c < strojenie::LICZBA_KLAS; ++c) {
+            klasy[c].algorytm = (c < 6) ? algorytm_mnozenia::naiwny : algorytm_mnozenia::blokowy;
+            klasy[c].blok = 64;
+            klasy[c].watki = (c < 8) ? 1 : sprzet;
+            klasy[c].prog_strassena = 256;
+        }
+    }
+};
+
+tablica_strojenia& tablica() {
+    static tablica_strojenia t;
+    return t;
+}
+
+/**
+ * @brief Numer klasy rozmiaru: najmniejsze c, dla którego n ≤ 2^c.
+ */
+int klasa(int n) {
+    int c = 0;
+    while (c < strojenie::LICZBA_KLAS - 1 && (1 << c) < n) ++c;
+    return c;
+}
+
+/**
+ * @brief Usuwa białe znaki z początku i końca napisu.
+ */
+std::string przytnij(const std::string& s) {
+    std::size_t p = s.find_first_not_of(" \t\r\n");
+    if (p == std::string::npos) return std::string();
+    return s.substr(p, s.find_last_not_of(" \t\r\n") - p + 1);
+}
+
+/**
+ * @brief Nazwa modelu procesora, którą oznaczany jest plik pamięci podręcznej.
+ *
+ * Na x86 jest to napis marki z cpuid (liście 0x80000002-0x80000004), w pozostałych
+ * przypadkach na Linuksie pole "model name" z /proc/cpuinfo; gdy żadne źródło nie
+ * jest dostępne - "nieznany".
+ */
+std::string identyfikator_procesora() {
+    static const std::string id = [] {
+        std::string nazwa;
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        unsigned r[4];
+        if (__get_cpuid(0x80000000u, &r[0], &r[1], &r[2], &r[3]) && r[0] >= 0x80000004u) {
+            char marka[49] = {};
+            for (unsigned lisc = 0; lisc < 3; ++lisc) {
+                __get_cpuid(0x80000002u + lisc, &r[0], &r[1], &r[2], &r[3]);
+                std::copy(reinterpret_cast<const char*>(r), reinterpret_cast<const char*>(r) + 16, marka + 16 * lisc);
+            }
+            nazwa = przytnij(marka);
+        }
+#endif
+#if defined(__linux__)
+        if (nazwa.empty()) {
+            std::ifstream info("/proc/cpuinfo");
+            std::string wiersz;
+            while (std::getline(info, wiersz)) {
+                if (wiersz.compare(0, 10, "model name") != 0) continue;
+                std::size_t dwukropek = wiersz.find(':');
+                if (dwukropek != std::string::npos) nazwa = przytnij(wiersz.substr(dwukropek + 1));
+                break;
+            }
+        }
+#endif
+        return nazwa.empty() ? std::string("nieznany") : nazwa;
+    }();
+    return id;
+}
+
+/**
+ * @brief Wczytuje i weryfikuje plik pamięci podręcznej; przy błędzie nie zmienia tablicy.
+ */
+bool wczytaj_plik(const std::string& sciezka) {
+    std::ifstream plik(sciezka);
+    if (!plik) return false;
+
+    std::string naglowek, klucz, klucz_procesora, procesor;
+    int wersja = 0, sprzet = 0;
+    if (!(plik >> naglowek >> wersja >> klucz >> sprzet >> klucz_procesora)) return false;
+    if (naglowek != "matrix_tuning" || wersja != 2 || klucz != "watki_sprzetowe" || klucz_procesora != "procesor") return false;
+    if (sprzet != liczba_watkow_sprzetowych()) return false;
+    if (!std::getline(plik, procesor) || przytnij(procesor) != identyfikator_procesora()) return false;
+
+    parametry_mnozenia nowe[strojenie::LICZBA_KLAS];
+    for (int c = 0; c < strojenie::LICZBA_KLAS; ++c) {
+        int nr, alg;
+        parametry_mnozenia& p = nowe[c];
+        if (!(plik >> nr >> alg >> p.blok >> p.watki >> p.prog_strassena)) return false;
+        if (nr != c || alg < 0 || alg > 2 || p.blok < 1 || p.watki < 1 || p.prog_strassena < 1) return false;
+        p.algorytm = static_cast<algorytm_mnozenia>(alg);
+    }
+
+    std::lock_guard<std::mutex> lock(tablica().blokada);
+    std::copy(nowe, nowe + strojenie::LICZBA_KLAS, tablica().klasy);
+    return true;
+}
+
+/**
+ * @brief Przy pierwszym wywołaniu próbuje wczytać domyślny plik pamięci podręcznej.
+ */
+void upewnij_wczytanie() {
+    std::call_once(tablica().wczytano, [] { wczytaj_plik(strojenie::domyslna_sciezka()); });
+}
+
+/**
+ * @brief Wykonuje mnożenie według podanych parametrów.
+ */
+void wykonaj(matrix_view dst, const_matrix_view a, const_matrix_view b, const parametry_mnozenia& p) {
+    switch (p.algorytm) {
+        case algorytm_mnozenia::naiwny:
+            mnoz(dst, a, b);
+            break;
+        case algorytm_mnozenia::blokowy:
+            mnoz_blokowo(dst, a, b, p.blok, p.watki);
+            break;
+        case algorytm_mnozenia::strassen:
+            mnoz_strassen(dst, a, b, p.prog_strassena, p.blok, p.watki);
+            break;
+    }
+}
+
+/**
+ * @brief Zwraca najkrótszy z dwóch czasów (w sekundach) mnożenia z danymi parametrami.
+ */
+double zmierz(matrix_view dst, const_matrix_view a, const_matrix_view b, const parametry_mnozenia& p) {
+    double najlepszy = 0;
+    for (int proba = 0; proba < 2; ++proba) {
+        auto start = std::chrono::steady_clock::now();
+        wykonaj(dst, a, b, p);
+        std::chrono::duration<double> czas = std::chrono::steady_clock::now() - start;
+        if (proba == 0 || czas.count() < najlepszy) najlepszy = czas.count();
+    }
+    return najlepszy;
+}
+
+} // namespace
+
+// --- Dostęp do parametrów ---
+
+/**
+ * @brief Zwraca parametry mnożenia dla macierzy o boku n.
+ * @param n Rozmiar macierzy.
+ * @return Parametry klasy rozmiaru zawierającej n.
+ */
+parametry_mnozenia strojenie::parametry(int n) {
+    upewnij_wczytanie();
+    std::lock_guard<std::mutex> lock(tablica().blokada);
+    return tablica().klasy[klasa(n)];
+}
+
+/**
+ * @brief Nadpisuje parametry klasy rozmiaru zawierającej n.
+ * @param n Dowolny rozmiar z klasy.
+ * @param p Nowe parametry.
+ */
+void strojenie::ustaw(int n, const parametry_mnozenia& p) {
+    upewnij_wczytanie();
+    std::lock_guard<std::mutex> lock(tablica().blokada);
+    tablica().klasy[klasa(n)] = p;
+}
+
+// --- Pomiary ---
+
+/**
+ * @brief Mierzy kandydujące konfiguracje dla klas rozmiarów od 64 do max_n.
+ *
+ * Pomiary wykonywane są na macierzach z wartościami [0, 9] bez blokady tablicy;
+ * wartości pochodzą z lokalnego generatora o stałym ziarnie, więc strojenie nie
+ * przesuwa sekwencji rand() (a tym samym losuj()) użytkownika.
+ * Wynik klasy zapisywany jest od razu, więc równoległe mnożenia korzystają
+ * z nowych parametrów, gdy tylko staną się dostępne. Po ostatniej klasie
+ * tablica trafia do pliku domyslna_sciezka().
+ *
+ * @param max_n Największy mierzony rozmiar (zaokrąglany w górę do potęgi dwójki).
+ * @param zapisz_wyniki Czy zapisać tablicę do pliku pamięci podręcznej po pomiarach.
+ */
+void strojenie::dostroj(int max_n, bool zapisz_wyniki) {
+    upewnij_wczytanie();
+    int sprzet = liczba_watkow_sprzetowych();
+    std::vector<int> kandydaci_watkow;
+    for (int w = 1; w < sprzet; w *= 2) kandydaci_watkow.push_back(w);
+    kandydaci_watkow.push_back(sprzet);
+
+    std::mt19937 generator(12345);
+    std::uniform_int_distribution<int> cyfra(0, 9);
+    for (int c = 6; c <= klasa(max_n); ++c) {
+        int s = 1 << c;
+        std::vector<int> da(static_cast<std::size_t>(s) * s), db(da.size()), dc(da.size());
+        for (std::size_t i = 0; i < da.size(); ++i) {
+            da[i] = cyfra(generator);
+            db[i] = cyfra(generator);
+        }
+        const_matrix_view a(da.data(), s, s, s), b(db.data(), s, s, s);
+        matrix_view wynik(dc.data(), s, s, s);
+
+        parametry_mnozenia najlepsze = {algorytm_mnozenia::naiwny, 64, 1, 256};
+        double najlepszy_czas = zmierz(wynik, a, b, najlepsze);
+
+        parametry_mnozenia najlepszy_blokowy = {algorytm_mnozenia::blokowy, 64, 1, 256};
+        double czas_blokowy = -1;
+        for (int blok = 32; blok <= 256 && blok <= s; blok *= 2) {
+            for (int w : kandydaci_watkow) {
+                parametry_mnozenia p = {algorytm_mnozenia::blokowy, blok, w, 256};
+                double t = zmierz(wynik, a, b, p);
+                if (czas_blokowy < 0 || t < czas_blokowy) {
+                    czas_blokowy = t;
+                    najlepszy_blokowy = p;
+                }
+            }
+        }
+        if (czas_blokowy >= 0 && czas_blokowy < najlepszy_czas) {
+            najlepszy_czas = czas_blokowy;
+            najlepsze = najlepszy_blokowy;
+        }
+
+        for (int prog = 64; prog <= 512 && prog < s; prog *= 2) {
+            parametry_mnozenia p = najlepszy_blokowy;
+            p.algorytm = algorytm_mnozenia::strassen;
+            p.prog_strassena = prog;
+            double t = zmierz(wynik, a, b, p);
+            if (t < najlepszy_czas) {
+                najlepszy_czas = t;
+                najlepsze = p;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(tablica().blokada);
+        tablica().klasy[c] = najlepsze;
+        // Klasy powyżej mierzonego zakresu dziedziczą wynik największej zmierzonej
+        if (c == klasa(max_n)) {
+            for (int d = c + 1; d < LICZBA_KLAS; ++d) tablica().klasy[d] = najlepsze;
+        }
+    }
+    if (zapisz_wyniki) zapisz(domyslna_sciezka());
+}
+
+// --- Plik pamięci podręcznej ---
+
+/**
+ * @brief Ścieżka pliku pamięci podręcznej strojenia.
+ * @return Wartość zmiennej środowiskowej MATRIX_TUNING_CACHE lub "matrix_tuning.cache".
+ */
+std::string strojenie::domyslna_sciezka() {
+    const char* env = std::getenv("MATRIX_TUNING_CACHE");
+    return (env && *env) ? std::string(env) : std::string("matrix_tuning.cache");
+}
+
+/**
+ * @brief Zapisuje tablicę parametrów do pliku tekstowego.
+ *
+ * Format: nagłówek "matrix_tuning 2", liczba wątków sprzętowych, nazwa modelu
+ * procesora (do końca wiersza), a następnie po jednym wierszu
+ * "klasa algorytm blok watki prog" na klasę.
+ *
+ * @param sciezka Ścieżka pliku (pusta - domyslna_sciezka()).
+ * @return true jeśli zapis się powiódł.
+ */
+bool strojenie::zapisz(const std::string& sciezka) {
+    upewnij_wczytanie();
+    std::ofstream plik(sciezka.empty() ? domyslna_sciezka() : sciezka);
+    if (!plik) return false;
+    std::lock_guard<std::mutex> lock(tablica().blokada);
+    plik << "matrix_tuning 2\n";
+    plik << "watki_sprzetowe " << liczba_watkow_sprzetowych() << "\n";
+    plik << "procesor " << identyfikator_procesora() << "\n";
+    for (int c = 0; c < LICZBA_KLAS; ++c) {
+        const parametry_mnozenia& p = tablica().klasy[c];
+        plik << c << " " << static_cast<int>(p.algorytm) << " " << p.blok << " "
+             << p.watki << " " << p.prog_strassena << "\n";
+    }
+    return static_cast<bool>(plik);
+}
+
+/**
+ * @brief Wczytuje tablicę parametrów z pliku zapisanego przez zapisz().
+ *
+ * Plik jest odrzucany w całości, jeśli nagłówek się nie zgadza, którykolwiek wiersz
+ * jest niepoprawny lub zapisano go na maszynie o innej liczbie wątków sprzętowych
+ * albo innym modelu procesora.
+ *
+ * @param sciezka Ścieżka pliku (pusta - domyslna_sciezka()).
+ * @return true jeśli tablica została zastąpiona zawartością pliku.
+ */
+bool strojenie::wczytaj(const std::string& sciezka) {
+    upewnij_wczytanie();
+    return wczytaj_plik(sciezka.empty() ? domyslna_sciezka() : sciezka);
+}
+
+// --- Mnożenie ---
+
+/**
+ * @brief Mnożenie macierzowe z wariantem wybranym przez strojenie (dst = a · b).
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ */
+void mnoz_dostrojone(matrix_view dst, const_matrix_view a, const_matrix_view b) {
+    int rozmiar = std::max(a.liczba_wierszy(), std::max(a.liczba_kolumn(), b.liczba_kolumn()));
+    wykonaj(dst, a, b, strojenie::parametry(rozmiar));
+}
@@ -0,0 +1,106 @@
+#ifndef MATRIX_TUNING_H
+#define MATRIX_TUNING_H
+
+#include <string>
+#include "matrix_view.h"
+
+/**
+ * @enum algorytm_mnozenia
+ * @brief Dostępne warianty mnożenia macierzy.
+ */
+enum class algorytm_mnozenia {
+    naiwny,   ///< Jądro mnoz() - pętle i-k-j bez kafelkowania
+    blokowy,  ///< mnoz_blokowo() - kafelkowanie i wielowątkowość
+    strassen  ///< mnoz_strassen() - rekurencja Strassena z liśćmi blokowymi
+};
+
+/**
+ * @struct parametry_mnozenia
+ * @brief Konfiguracja mnożenia wybrana dla jednej klasy rozmiarów.
+ */
+struct parametry_mnozenia {
+    algorytm_mnozenia algorytm; ///< Wybrany wariant
+    int blok;                   ///< Bok kafelka (blokowy, liście Strassena)
+    int watki;                  ///< Liczba wątków (blokowy, liście Strassena)
+    int prog_strassena;         ///< Bok, poniżej którego Strassen przechodzi na mnożenie blokowe
+};
+
+/**
+ * @class strojenie
+ * @brief Empiryczny wybór algorytmu, rozmiaru kafelka i liczby wątków mnożenia.
+ *
+ * Rozmiary dzielone są na klasy potęg dwójki: klasa c obejmuje n z przedziału
+ * (2^(c-1), 2^c]. Dla każdej klasy przechowywany jest jeden zestaw parametrów.
+ * Przy pierwszym użyciu tablica jest wczytywana z pliku pamięci podręcznej
+ * (domyslna_sciezka()); jeśli plik nie istnieje lub pochodzi z maszyny o innej
+ * liczbie wątków sprzętowych albo innym modelu procesora, używane są wartości
+ * domyślne aż do wywołania dostroj().
+ */
+class strojenie {
+public:
+    static const int LICZBA_KLAS = 16; ///< Obsługiwane klasy: n ≤ 2^15, większe korzystają z ostatniej
+
+    /**
+     * @brief Zwraca parametry mnożenia dla macierzy o boku n.
+     * @param n Rozmiar macierzy.
+     * @return Parametry klasy rozmiaru zawierającej n.
+     */
+    static parametry_mnozenia parametry(int n);
+
+    /**
+     * @brief Nadpisuje parametry klasy rozmiaru zawierającej n.
+     * @param n Dowolny rozmiar z klasy.
+     * @param p Nowe parametry.
+     */
+    static void ustaw(int n, const parametry_mnozenia& p);
+
+    /**
+     * @brief Mierzy kandydujące konfiguracje dla klas rozmiarów od 64 do max_n.
+     *
+     * Dla każdej klasy sprawdzane są: jądro naiwne, mnożenie blokowe dla kafelków
+     * 32-256 i liczby wątków 1, 2, 4, ... aż do liczby wątków sprzętowych, oraz
+     * Strassen z progami 64-512 dla najlepszej konfiguracji blokowej. Wygrywa
+     * najkrótszy z dwóch pomiarów. Klasy mniejsze niż 64 pozostają naiwne.
+     * Wyniki zapisywane są do domyslna_sciezka(), więc kolejne uruchomienia
+     * wczytują je zamiast mierzyć od nowa.
+     *
+     * @param max_n Największy mierzony rozmiar (zaokrąglany w górę do potęgi dwójki).
+     * @param zapisz_wyniki Czy zapisać tablicę do pliku pamięci podręcznej po pomiarach.
+     */
+    static void dostroj(int max_n = 1024, bool zapisz_wyniki = true);
+
+    /**
+     * @brief Zapisuje tablicę parametrów do pliku tekstowego.
+     * @param sciezka Ścieżka pliku (pusta - domyslna_sciezka()).
+     * @return true jeśli zapis się powiódł.
+     */
+    static bool zapisz(const std::string& sciezka = "");
+
+    /**
+     * @brief Wczytuje tablicę parametrów z pliku zapisanego przez zapisz().
+     * @param sciezka Ścieżka pliku (pusta - domyslna_sciezka()).
+     * @return true jeśli plik istniał, był poprawny i pochodził z maszyny o tej samej liczbie wątków i tym samym procesorze.
+     */
+    static bool wczytaj(const std::string& sciezka = "");
+
+    /**
+     * @brief Ścieżka pliku pamięci podręcznej strojenia.
+     * @return Wartość zmiennej środowiskowej MATRIX_TUNING_CACHE lub "matrix_tuning.cache".
+     */
+    static std::string domyslna_sciezka();
+};
+
+/**
+ * @brief Mnożenie macierzowe z wariantem wybranym przez strojenie (dst = a · b).
+ *
+ * Parametry dobierane są według największego z wymiarów operandów. Warianty
+ * wymagające macierzy kwadratowych same przechodzą na mnożenie blokowe dla widoków
+ * prostokątnych.
+ *
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ */
+void mnoz_dostrojone(matrix_view dst, const_matrix_view a, const_matrix_view b);
+
+#endif
@@ -0,0 +1,155 @@
+#include "matrix_view.h"
+
+// --- Funkcje pomocnicze ---
+
+/**
+ * @brief Sprawdza, czy dwa widoki mają identyczne wymiary.
+ */
+static bool te_same_wymiary(const_matrix_view a, const_matrix_view b) {
+    return a.liczba_wierszy() == b.liczba_wierszy() && a.liczba_kolumn() == b.liczba_kolumn();
+}
+
+// --- Wypełnianie i kopiowanie ---
+
+/**
+ * @brief Wypełnia wszystkie elementy widoku zadaną wartością.
+ * @param v Widok docelowy.
+ * @param wartosc Wartość do wpisania.
+ */
+void wypelnij(matrix_view v, int wartosc) {
+    for (int i = 0; i < v.liczba_wierszy(); ++i)
+        for (int j = 0; j < v.liczba_kolumn(); ++j)
+            v(i, j) = wartosc;
+}
+
+/**
+ * @brief Kopiuje elementy jednego widoku do drugiego (dst = src).
+ * @param dst Widok docelowy.
+ * @param src Widok źródłowy o tych samych wymiarach.
+ */
+void kopiuj(matrix_view dst, const_matrix_view src) {
+    if (!te_same_wymiary(dst, src)) return;
+    for (int i = 0; i < dst.liczba_wierszy(); ++i)
+        for (int j = 0; j < dst.liczba_kolumn(); ++j)
+            dst(i, j) = src(i, j);
+}
+
+// --- Arytmetyka ---
+
+/**
+ * @brief Dodaje dwa widoki element po elemencie (dst = a + b).
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Pierwszy składnik.
+ * @param b Drugi składnik.
+ */
+void dodaj(matrix_view dst, const_matrix_view a, const_matrix_view b) {
+    if (!te_same_wymiary(dst, a) || !te_same_wymiary(a, b)) return;
+    for (int i = 0; i < dst.liczba_wierszy(); ++i)
+        for (int j = 0; j < dst.liczba_kolumn(); ++j)
+            dst(i, j) = a(i, j) + b(i, j);
+}
+
+/**
+ * @brief Dodaje skalar do każdego elementu widoku (dst += a).
+ * @param dst Widok modyfikowany.
+ * @param a Wartość skalarna.
+ */
+void dodaj(matrix_view dst, int a) {
+    for (int i = 0; i < dst.liczba_wierszy(); ++i)
+        for (int j = 0; j < dst.liczba_kolumn(); ++j)
+            dst(i, j) += a;
+}
+
+/**
+ * @brief Mnoży każdy element widoku przez skalar (dst *= a).
+ * @param dst Widok modyfikowany.
+ * @param a Wartość skalarna.
+ */
+void pomnoz(matrix_view dst, int a) {
+    for (int i = 0; i < dst.liczba_wierszy(); ++i)
+        for (int j = 0; j < dst.liczba_kolumn(); ++j)
+            dst(i, j) *= a;
+}
+
+/**
+ * @brief Mnożenie macierzowe z akumulacją (dst += a · b).
+ *
+ * Pętle w kolejności i-k-j: wewnętrzna pętla przebiega wiersz b i wiersz dst,
+ * więc dla widoków o kroku kolumny 1 dostęp do pamięci jest sekwencyjny.
+ *
+ * @param dst Widok wynikowy (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ */
+void mnoz_dodaj(matrix_view dst, const_matrix_view a, const_matrix_view b) {
+    int h = a.liczba_wierszy();
+    int k = a.liczba_kolumn();
+    int w = b.liczba_kolumn();
+    if (b.liczba_wierszy() != k || dst.liczba_wierszy() != h || dst.liczba_kolumn() != w) return;
+
+    bool ciagle = dst.krok_kolumny() == 1 && b.krok_kolumny() == 1;
+    for (int i = 0; i < h; ++i) {
+        for (int p = 0; p < k; ++p) {
+            int aip = a(i, p);
+            if (aip == 0) continue;
+            if (ciagle) {
+                int* wiersz_c = &dst(i, 0);
+                const int* wiersz_b = &b(p, 0);
+                for (int j = 0; j < w; ++j) wiersz_c[j] += aip * wiersz_b[j];
+            } else {
+                for (int j = 0; j < w; ++j) dst(i, j) += aip * b(p, j);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Mnożenie macierzowe widoków (dst = a · b).
+ * @param dst Widok wynikowy h×w (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ */
+void mnoz(matrix_view dst, const_matrix_view a, const_matrix_view b) {
+    if (b.liczba_wierszy() != a.liczba_kolumn() ||
+        dst.liczba_wierszy() != a.liczba_wierszy() || dst.liczba_kolumn() != b.liczba_kolumn()) return;
+    wypelnij(dst, 0);
+    mnoz_dodaj(dst, a, b);
+}
+
+// --- Porównania ---
+
+/**
+ * @brief Porównuje dwa widoki na równość.
+ * @return true jeśli wymiary i wszystkie elementy są identyczne.
+ */
+bool rowne(const_matrix_view a, const_matrix_view b) {
+    if (!te_same_wymiary(a, b)) return false;
+    for (int i = 0; i < a.liczba_wierszy(); ++i)
+        for (int j = 0; j < a.liczba_kolumn(); ++j)
+            if (a(i, j) != b(i, j)) return false;
+    return true;
+}
+
+/**
+ * @brief Sprawdza, czy każdy element a jest większy od odpowiadającego elementu b.
+ * @return false także przy niezgodnych wymiarach.
+ */
+bool wieksze(const_matrix_view a, const_matrix_view b) {
+    if (!te_same_wymiary(a, b)) return false;
+    for (int i = 0; i < a.liczba_wierszy(); ++i)
+        for (int j = 0; j < a.liczba_kolumn(); ++j)
+            if (a(i, j) <= b(i, j)) return false;
+    return true;
+}
+
+/**
+ * @brief Sprawdza, czy każdy element a jest mniejszy od odpowiadającego elementu b.
+ * @return false także przy niezgodnych wymiarach.
+ */
+bool mniejsze(const_matrix_view a, const_matrix_view b) {
+    if (!te_same_wymiary(a, b)) return false;
+    for (int i = 0; i < a.liczba_wierszy(); ++i)
+        for (int j = 0; j < a.liczba_kolumn(); ++j)
+            if (a(i, j) >= b(i, j)) return false;
+    return true;
+}
@@ -0,0 +1,200 @@
+#ifndef MATRIX_VIEW_H
+#define MATRIX_VIEW_H
+
+#include <memory>
+#include <type_traits>
+
+/**
+ * @brief Pusty znacznik widoków tylko do odczytu - ich czas życia nie jest śledzony.
+ */
+struct bez_znacznika {};
+
+/**
+ * @class basic_view
+ * @brief Lekki, nieposiadający widok na prostokątny fragment danych macierzy.
+ *
+ * Widok nie alokuje pamięci ani nie kopiuje elementów - przechowuje jedynie wskaźnik
+ * na pierwszy element, wymiary oraz kroki (stride) wiersza i kolumny. Element (x, y)
+ * znajduje się pod adresem ptr[x * krok_w + y * krok_k], dzięki czemu ten sam typ
+ * opisuje blok, wiersz, kolumnę oraz diagonalę macierzy.
+ *
+ * Widok pozostaje ważny tak długo, jak macierz, z której powstał, nie zmieni bufora
+ * (alokuj z większym rozmiarem, dowroc) ani nie zostanie zniszczona.
+ *
+ * Widok zapisywalny wydany przez macierz nosi współdzielony znacznik (kopiowany
+ * do bloków, wierszy i kolumn), po którym macierz poznaje, czy jakikolwiek jej
+ * widok zapisywalny wciąż istnieje. Widoki tylko do odczytu znacznika nie mają.
+ *
+ * @tparam T Typ elementu: int dla widoku modyfikowalnego, const int dla widoku tylko do odczytu.
+ */
+template <typename T>
+class basic_view {
+public:
+    /// Typ znacznika: współdzielony dla widoków zapisywalnych, pusty dla tylko do odczytu
+    using typ_znacznika = typename std::conditional<std::is_const<T>::value, bez_znacznika, std::shared_ptr<void>>::type;
+
+private:
+    T* ptr;       ///< Wskaźnik na element (0, 0) widoku
+    int wiersze;  ///< Liczba wierszy widoku
+    int kolumny;  ///< Liczba kolumn widoku
+    int krok_w;   ///< Odległość (w elementach) między kolejnymi wierszami
+    int krok_k;   ///< Odległość (w elementach) między kolejnymi kolumnami
+    typ_znacznika znacznik; ///< Znacznik życia widoku zapisywalnego wydanego przez macierz
+
+public:
+    /**
+     * @brief Domyślny konstruktor. Tworzy pusty widok 0×0.
+     */
+    basic_view() : ptr(nullptr), wiersze(0), kolumny(0), krok_w(0), krok_k(1) {}
+
+    /**
+     * @brief Tworzy widok na dowolny bufor.
+     * @param ptr Wskaźnik na element (0, 0).
+     * @param wiersze Liczba wierszy.
+     * @param kolumny Liczba kolumn.
+     * @param krok_w Krok między wierszami.
+     * @param krok_k Krok między kolumnami (domyślnie 1 - elementy wiersza leżą obok siebie).
+     * @param znacznik Znacznik życia widoku (tylko dla widoków wydawanych przez macierz).
+     */
+    basic_view(T* ptr, int wiersze, int kolumny, int krok_w, int krok_k = 1, typ_znacznika znacznik = typ_znacznika())
+        : ptr(ptr), wiersze(wiersze > 0 ? wiersze : 0), kolumny(kolumny > 0 ? kolumny : 0),
+          krok_w(krok_w), krok_k(krok_k), znacznik(std::move(znacznik)) {}
+
+    /**
+     * @brief Konwersja widoku modyfikowalnego na widok tylko do odczytu (bez znacznika).
+     * @param v Widok źródłowy.
+     */
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    basic_view(const basic_view<U>& v)
+        : ptr(v.dane()), wiersze(v.liczba_wierszy()), kolumny(v.liczba_kolumn()),
+          krok_w(v.krok_wiersza()), krok_k(v.krok_kolumny()) {}
+
+    /**
+     * @brief Dostęp do elementu widoku bez sprawdzania zakresu.
+     * @param x Indeks wiersza (0-based).
+     * @param y Indeks kolumny (0-based).
+     * @return Referencja do elementu.
+     */
+    T& operator()(int x, int y) const { return ptr[x * krok_w + y * krok_k]; }
+
+    T* dane() const { return ptr; }                    ///< @return Wskaźnik na element (0, 0).
+    int liczba_wierszy() const { return wiersze; }     ///< @return Liczba wierszy.
+    int liczba_kolumn() const { return kolumny; }      ///< @return Liczba kolumn.
+    int krok_wiersza() const { return krok_w; }        ///< @return Krok między wierszami.
+    int krok_kolumny() const { return krok_k; }        ///< @return Krok między kolumnami.
+    bool pusty() const { return wiersze == 0 || kolumny == 0; } ///< @return true dla widoku bez elementów.
+
+    /**
+     * @brief Tworzy widok na prostokątny fragment bieżącego widoku.
+     *
+     * Fragment wychodzący poza widok jest przycinany; fragment całkowicie poza nim daje widok pusty.
+     *
+     * @param x Wiersz lewego górnego rogu.
+     * @param y Kolumna lewego górnego rogu.
+     * @param h Liczba wierszy fragmentu.
+     * @param w Liczba kolumn fragmentu.
+     * @return Widok na fragment.
+     */
+    basic_view blok(int x, int y, int h, int w) const {
+        if (x < 0 || y < 0 || x >= wiersze || y >= kolumny) return basic_view();
+        if (h > wiersze - x) h = wiersze - x;
+        if (w > kolumny - y) w = kolumny - y;
+        return basic_view(ptr + x * krok_w + y * krok_k, h, w, krok_w, krok_k, znacznik);
+    }
+
+    /**
+     * @brief Tworzy widok 1×w na jeden wiersz.
+     * @param x Indeks wiersza (0-based).
+     * @return Widok na wiersz lub widok pusty, jeśli indeks jest poza zakresem.
+     */
+    basic_view wiersz(int x) const { return blok(x, 0, 1, kolumny); }
+
+    /**
+     * @brief Tworzy widok h×1 na jedną kolumnę.
+     * @param y Indeks kolumny (0-based).
+     * @return Widok na kolumnę lub widok pusty, jeśli indeks jest poza zakresem.
+     */
+    basic_view kolumna(int y) const { return blok(0, y, wiersze, 1); }
+};
+
+using matrix_view = basic_view<int>;             ///< Widok modyfikowalny
+using const_matrix_view = basic_view<const int>; ///< Widok tylko do odczytu
+
+// --- Jądra obliczeniowe na widokach ---
+// Wszystkie jądra sprawdzają zgodność wymiarów; przy niezgodności nie robią nic
+// (lub zwracają false), podobnie jak operatory klasy matrix.
+
+/**
+ * @brief Wypełnia wszystkie elementy widoku zadaną wartością.
+ * @param v Widok docelowy.
+ * @param wartosc Wartość do wpisania.
+ */
+void wypelnij(matrix_view v, int wartosc);
+
+/**
+ * @brief Kopiuje elementy jednego widoku do drugiego (dst = src).
+ * @param dst Widok docelowy.
+ * @param src Widok źródłowy o tych samych wymiarach.
+ */
+void kopiuj(matrix_view dst, const_matrix_view src);
+
+/**
+ * @brief Dodaje dwa widoki element po elemencie (dst = a + b).
+ * @param dst Widok docelowy (może pokrywać się z a lub b).
+ * @param a Pierwszy składnik.
+ * @param b Drugi składnik.
+ */
+void dodaj(matrix_view dst, const_matrix_view a, const_matrix_view b);
+
+/**
+ * @brief Dodaje skalar do każdego elementu widoku (dst += a).
+ * @param dst Widok modyfikowany.
+ * @param a Wartość skalarna.
+ */
+void dodaj(matrix_view dst, int a);
+
+/**
+ * @brief Mnoży każdy element widoku przez skalar (dst *= a).
+ * @param dst Widok modyfikowany.
+ * @param a Wartość skalarna.
+ */
+void pomnoz(matrix_view dst, int a);
+
+/**
+ * @brief Mnożenie macierzowe widoków (dst = a · b).
+ *
+ * Wymiary: a to h×k, b to k×w, dst to h×w. Widok dst nie może pokrywać się z a ani b.
+ *
+ * @param dst Widok wynikowy.
+ * @param a Lewy czynnik.
+ * @param b Prawy czynnik.
+ */
+void mnoz(matrix_view dst, const_matrix_view a, const_matrix_view b);
+
+/**
+ * @brief Mnożenie macierzowe z akumulacją (dst += a · b).
+ * @param dst Widok wynikowy (nie może pokrywać się z a ani b).
+ * @param a Lewy czynnik h×k.
+ * @param b Prawy czynnik k×w.
+ */
+void mnoz_dodaj(matrix_view dst, const_matrix_view a, const_matrix_view b);
+
+/**
+ * @brief Porównuje dwa widoki na równość.
+ * @return true jeśli wymiary i wszystkie elementy są identyczne.
+ */
+bool rowne(const_matrix_view a, const_matrix_view b);
+
+/**
+ * @brief Sprawdza, czy każdy element a jest większy od odpowiadającego elementu b.
+ * @return false także przy niezgodnych wymiarach.
+ */
+bool wieksze(const_matrix_view a, const_matrix_view b);
+
+/**
+ * @brief Sprawdza, czy każdy element a jest mniejszy od odpowiadającego elementu b.
+ * @return false także przy niezgodnych wymiarach.
+ */
+bool mniejsze(const_matrix_view a, const_matrix_view b);
+
+#endif